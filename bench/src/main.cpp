@@ -0,0 +1,161 @@
+#include "util/bench.h"
+#include "util/input.h"
+#include "util/parallel.h"
+#include "util/registry.h"
+
+#include <fmt/format.h>
+
+#include <charconv>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+namespace bench = aoc2025::bench;
+namespace registry = aoc2025::registry;
+namespace input = aoc2025::input;
+
+constexpr std::string_view usage =
+    "usage: aoc_bench [--warmup N] [--iterations N] [--input-dir DIR] [--filter TEXT]\n"
+    "                 [--json FILE] [--baseline FILE] [--threads N]\n"
+    "Inputs are read from DIR/dayNN.txt, days without an input are skipped.\n"
+    "Parallel solvers use N threads ($AOC_THREADS or all cores by default).";
+
+struct Arguments
+{
+    bench::Options options;
+    std::string inputDir = ".";
+    std::string filter;
+    std::optional<std::string> json;
+    std::optional<std::string> baseline;
+};
+
+std::optional<int> parseCount(std::string_view value)
+{
+    int result = 0;
+    const auto* end = std::data(value) + std::size(value);
+    auto [ptr, ec] = std::from_chars(std::data(value), end, result);
+    if (ec != std::errc{} || ptr != end || result < 0)
+        return std::nullopt;
+    return result;
+}
+
+std::optional<Arguments> parseArguments(std::span<char*> args)
+{
+    Arguments result;
+    for (std::size_t i = 0; i < std::size(args); ++i)
+    {
+        std::string_view name = args[i];
+        if (i + 1 == std::size(args))
+            return std::nullopt;
+        std::string_view value = args[++i];
+
+        if (name == "--warmup")
+        {
+            auto count = parseCount(value);
+            if (not count)
+                return std::nullopt;
+            result.options.warmup = *count;
+        }
+        else if (name == "--iterations")
+        {
+            auto count = parseCount(value);
+            if (not count || *count == 0)
+                return std::nullopt;
+            result.options.iterations = *count;
+        }
+        else if (name == "--input-dir")
+            result.inputDir = value;
+        else if (name == "--filter")
+            result.filter = value;
+        else if (name == "--json")
+            result.json = std::string{value};
+        else if (name == "--threads")
+        {
+            auto count = parseCount(value);
+            if (not count || *count == 0)
+                return std::nullopt;
+            aoc2025::parallel::setThreadCount(*count);
+        }
+        else if (name == "--baseline")
+            result.baseline = std::string{value};
+        else
+            return std::nullopt;
+    }
+    return result;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    auto arguments = parseArguments(std::span{argv + 1, argv + argc});
+    if (not arguments)
+    {
+        fmt::println("{}", usage);
+        return 1;
+    }
+
+    bench::Baseline baseline;
+    if (arguments->baseline)
+    {
+        auto file = input::InputFile::open(*arguments->baseline);
+        if (not file)
+        {
+            fmt::println("Failed to read baseline {}", *arguments->baseline);
+            return 1;
+        }
+        baseline = bench::parseBaseline(file->content());
+    }
+
+    std::vector<bench::Statistics> results;
+    for (const auto& solution : registry::sortedSolutions())
+    {
+        if (solution.name.find(arguments->filter) == std::string::npos)
+            continue;
+
+        auto path = fmt::format("{}/day{:02}.txt", arguments->inputDir, solution.day);
+        auto file = input::InputFile::open(path);
+        if (not file)
+        {
+            fmt::println("{}: no input at {}, skipped", solution.name, path);
+            continue;
+        }
+
+        auto content = file->content();
+        auto parts = solution.load(content);
+        if (std::empty(parts))
+        {
+            fmt::println("{}: failed to parse {}, skipped", solution.name, path);
+            continue;
+        }
+
+        results.push_back(bench::run(  //
+            fmt::format("{}.parse", solution.name),
+            [&] { return solution.load(content); },
+            arguments->options));
+        for (const auto& part : parts)
+        {
+            results.push_back(bench::run(  //
+                fmt::format("{}.part{}", solution.name, part.number),
+                part.solve,
+                arguments->options));
+        }
+    }
+
+    bench::printReport(results, baseline);
+    if (arguments->json)
+    {
+        std::ofstream file(*arguments->json);
+        file << bench::toJson(results, baseline);
+        if (not file)
+        {
+            fmt::println("Failed to write {}", *arguments->json);
+            return 1;
+        }
+    }
+    return 0;
+}
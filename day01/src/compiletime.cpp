@@ -0,0 +1,18 @@
+#include "day01.h"
+
+#include "util/embed.h"
+
+#include <fmt/format.h>
+
+namespace
+{
+using namespace aoc2025::day01;
+
+constexpr auto answers = solve(readInput(aoc2025::embed::input));
+}  // namespace
+
+int main()
+{
+    fmt::println("day01.1: {}", answers.stops);
+    fmt::println("day01.2: {}", answers.passes);
+}
@@ -0,0 +1,334 @@
+#pragma once
+
+#include "util/parallel.h"
+#include "util/parse.h"
+#include "util/trace.h"
+
+#include <fmt/ranges.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <span>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace aoc2025::day01
+{
+constexpr auto fullCycle = 100;
+constexpr auto trace = diagnostic::makeTracer<false>();
+
+struct RotationResult
+{
+    int rotations = 0;
+    int newPos = 0;
+};
+
+constexpr RotationResult rotate(int pos, int val, int cycle = fullCycle)
+{
+    assert(pos >= 0 && pos < cycle && "position out of bounds");
+    auto newPos = pos + val;
+    return newPos <= 0 // todo: probably can be generalized with std::abs, but screw it
+               ? RotationResult{(-newPos) / fullCycle + int{pos != 0},
+                                (fullCycle - ((-newPos) % fullCycle)) % fullCycle}
+               : RotationResult{newPos / fullCycle, newPos % fullCycle};
+}
+
+constexpr int solve1(std::span<const int> input, int start = 50)
+{
+    auto [_, count] = std::ranges::fold_left(  //
+        input,
+        std::tuple{start, int{start == 0}},
+        [](auto acc, auto v)
+        {
+            auto [pos, counter] = acc;
+            auto [_, newPos] = rotate(pos, v);
+            return std::tuple{newPos, counter + (newPos == 0)};
+        });
+    return count;
+}
+
+
+static_assert(solve1(
+                  std::array{
+                      -49,
+                      -200,
+                      50,
+                      -150,
+                  },
+                  49)
+              == 3);
+static_assert(solve1(std::array{-68, -30, 48, -5, 60, -55, -1, -99, 14, -82}) == 3);
+
+
+constexpr int solve2(std::span<const int> input, int start = 50)
+{
+    auto [_, count] = std::ranges::fold_left(  //
+        input,
+        std::tuple{start, int{start == 0}},
+        [](auto acc, auto v)
+        {
+            auto [pos, counter] = acc;
+            auto [rotations, newPos] = rotate(pos, v);
+
+            trace("{} + {} = {}", acc, v, std::tuple{newPos, counter + rotations});
+            return std::tuple{newPos, counter + rotations};
+        });
+    return count;
+}
+
+static_assert(solve2(std::array{-68, -30, 48, -5, 60, -55, -1, -99, 14, -82}) == 6);
+
+/**
+ * Zeros seen by the dial: `stops` counts rotations ending at 0 (part 1), `passes` counts
+ * every click pointing at 0, during a rotation or at its end (part 2).
+ */
+struct ZeroCounts
+{
+    std::int64_t stops = 0;
+    std::int64_t passes = 0;
+
+    constexpr ZeroCounts& operator+=(const ZeroCounts& other)
+    {
+        stops += other.stops;
+        passes += other.passes;
+        return *this;
+    }
+
+    constexpr bool operator==(const ZeroCounts&) const = default;
+};
+
+namespace detail
+{
+constexpr std::size_t tileSize = 1024;
+constexpr std::size_t blockSize = 64 * tileSize;  // smaller blocks cost more than they save
+
+constexpr int floorMod(std::int64_t value)
+{
+    auto result = static_cast<int>(value % fullCycle);
+    return result < 0 ? result + fullCycle : result;
+}
+
+/**
+ * Zeros of consecutive rotations starting at `pos` (moved to the final position), a
+ * tile at a time. Every rotation is
+ * split into full turns and a remainder below a cycle; only the prefix sum of the
+ * remainders is serial (an add per rotation), turns and the zeros between consecutive
+ * positions are independent per rotation, so those loops vectorize.
+ */
+constexpr ZeroCounts countZeros(std::span<const int> rotations, int& pos)
+{
+    // a multiple of the cycle keeping every position of a tile positive
+    constexpr auto bias = static_cast<std::uint32_t>(fullCycle * (tileSize + 1));
+    constexpr auto cycle = static_cast<std::uint32_t>(fullCycle);
+
+    ZeroCounts result;
+    std::array<std::uint32_t, tileSize + 1> positions{};
+    for (std::size_t first = 0; first < std::size(rotations); first += tileSize)
+    {
+        auto tile = rotations.subspan(first, std::min(tileSize, std::size(rotations) - first));
+        auto size = std::size(tile);
+
+        std::int64_t turns = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            auto quotient = static_cast<std::int64_t>(tile[i] / fullCycle);
+            turns += quotient < 0 ? -quotient : quotient;
+            positions[i + 1] = static_cast<std::uint32_t>(tile[i] % fullCycle);
+        }
+
+        positions[0] = bias + static_cast<std::uint32_t>(pos);
+        for (std::size_t i = 0; i < size; ++i)
+            positions[i + 1] += positions[i];  // wraps back for negative remainders
+
+        std::uint32_t stops = 0;
+        std::uint32_t passes = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            auto from = positions[i];
+            auto to = positions[i + 1];
+            stops += to % cycle == 0;
+            // multiples of the cycle in (from, to] turning right, in [to, from) turning left
+            passes += to > from ? to / cycle - from / cycle : (from - 1) / cycle - (to - 1) / cycle;
+        }
+
+        result.stops += stops;
+        result.passes += turns + passes;
+        pos = static_cast<int>(positions[size] % cycle);
+    }
+    return result;
+}
+}  // namespace detail
+
+/**
+ * Both parts in one pass: the dial position after k rotations is the prefix sum of the
+ * rotations modulo the cycle. Long inputs are split into blocks, block sums are computed
+ * in parallel and scanned to get the start position of every block, then the blocks
+ * count their zeros in parallel.
+ */
+constexpr ZeroCounts solve(std::span<const int> input, int start = 50)
+{
+    assert(start >= 0 && start < fullCycle && "position out of bounds");
+    ZeroCounts result{int{start == 0}, int{start == 0}};
+
+    auto size = std::size(input);
+    auto chunks = std::min(size / detail::blockSize, parallel::maxChunks);
+    if (parallel::threadCount() < 2 || chunks < 2)
+    {
+        auto pos = start;
+        return result += detail::countZeros(input, pos);
+    }
+
+    auto chunkOf = [&](std::size_t chunk)
+    {
+        auto [begin, end] = parallel::chunkBounds(size, chunks, chunk);
+        return input.subspan(begin, end - begin);
+    };
+
+    std::vector<std::int64_t> offsets(chunks + 1);
+    parallel::forEachIndex(  //
+        chunks,
+        [&](std::size_t chunk)
+        {
+            offsets[chunk + 1] =
+                std::ranges::fold_left(chunkOf(chunk), std::int64_t{0}, std::plus<>{});
+        });
+    offsets[0] = start;
+    std::partial_sum(std::begin(offsets), std::end(offsets), std::begin(offsets));
+
+    std::vector<ZeroCounts> counts(chunks);
+    parallel::forEachIndex(  //
+        chunks,
+        [&](std::size_t chunk)
+        {
+            auto pos = detail::floorMod(offsets[chunk]);
+            counts[chunk] = detail::countZeros(chunkOf(chunk), pos);
+        });
+    for (const auto& count : counts)
+        result += count;
+    return result;
+}
+
+static_assert(solve(std::array{-49, -200, 50, -150}, 49).stops == 3);
+static_assert(solve(std::array{-68, -30, 48, -5, 60, -55, -1, -99, 14, -82})
+              == ZeroCounts{.stops = 3, .passes = 6});
+static_assert(
+    []
+    {
+        // crosses tile boundaries, matches the rotation by rotation folds
+        std::vector<int> rotations;
+        for (int i = 0; i < 3000; ++i)
+            rotations.push_back((i * 7919 % 2001 - 1000) * (i % 5 == 0 ? 7 : 1));
+        return solve(rotations, 0) == ZeroCounts{solve1(rotations, 0), solve2(rotations, 0)};
+    }());
+
+/**
+ * Both parts over rotations fed as raw text ("L68\nR48\n...") in pieces of any size, a
+ * rotation may be split between pieces. Memory is constant: the dial position, the
+ * counts, the number being parsed and one tile of rotations waiting to be counted.
+ */
+class ZeroCounter
+{
+public:
+    constexpr explicit ZeroCounter(int start = 50)
+        : pos_(start)
+        , counts_{int{start == 0}, int{start == 0}}
+    {
+        assert(start >= 0 && start < fullCycle && "position out of bounds");
+    }
+
+    constexpr void feed(std::string_view text)
+    {
+        for (auto ch : text)
+        {
+            if (parse::detail::isDigit(ch))
+            {
+                value_ = value_ * 10 + (ch - '0');
+                digits_ = true;
+                continue;
+            }
+            push();
+            negative_ = ch == 'L';  // like parse::parseIntegers, only directly before a number
+        }
+    }
+
+    /**
+     * Counts up to here, the last rotation may lack its line break.
+     */
+    constexpr ZeroCounts finish()
+    {
+        push();
+        flush();
+        return counts_;
+    }
+
+private:
+    constexpr void push()
+    {
+        if (not digits_)
+            return;
+        pending_[size_++] = negative_ ? -value_ : value_;
+        value_ = 0;
+        digits_ = false;
+        if (size_ == std::size(pending_))
+            flush();
+    }
+
+    constexpr void flush()
+    {
+        counts_ += detail::countZeros(std::span{pending_}.first(size_), pos_);
+        size_ = 0;
+    }
+
+    int pos_ = 0;
+    ZeroCounts counts_;
+    int value_ = 0;
+    bool digits_ = false;
+    bool negative_ = false;
+    std::array<int, detail::tileSize> pending_{};
+    std::size_t size_ = 0;
+};
+
+static_assert(
+    []
+    {
+        ZeroCounter counter;
+        for (auto piece : {"L68\nL30\nR4", "8\nL5\nR60\nL", "55\nL1\nL99\nR14\nL82"})
+            counter.feed(piece);
+        return counter.finish() == ZeroCounts{.stops = 3, .passes = 6};
+    }());
+static_assert(
+    []
+    {
+        // more rotations than a tile, one byte at a time
+        std::string text;
+        for (int i = 0; i < 3000; ++i)
+        {
+            text += i % 3 == 0 ? 'L' : 'R';
+            for (auto value = i * 7919 % 1001; auto divisor : {100, 10, 1})
+                text += static_cast<char>('0' + value / divisor % 10);
+            text += '\n';
+        }
+        ZeroCounter counter{0};
+        for (auto ch : text)
+            counter.feed(std::string_view{&ch, 1});
+        auto input = parse::parseIntegers<int>(text, 'L');
+        return counter.finish() == solve(input, 0);
+    }());
+
+/**
+ * Rotations as signed distances, "L" turns left (negative).
+ */
+constexpr std::vector<int> readInput(std::string_view content)
+{
+    return parse::parseIntegers<int>(content, 'L');
+}
+}  // namespace aoc2025::day01
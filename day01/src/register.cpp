@@ -0,0 +1,27 @@
+#include "day01.h"
+
+#include "util/registry.h"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace aoc2025::day01
+{
+namespace
+{
+const registry::Registrar registrar{{
+    .name = "day01",
+    .day = 1,
+    .load =
+        [](std::string_view content)
+    {
+        auto input = std::make_shared<const std::vector<int>>(readInput(content));
+        return std::vector{
+            registry::makePart(1, [input] { return solve(*input).stops; }),
+            registry::makePart(2, [input] { return solve(*input).passes; }),
+        };
+    },
+}};
+}  // namespace
+}  // namespace aoc2025::day01
@@ -0,0 +1,24 @@
+#include "day02.h"
+
+#include "util/embed.h"
+
+#include <fmt/format.h>
+
+#include <utility>
+
+namespace
+{
+using namespace aoc2025::day02;
+
+constexpr auto answers = []
+{
+    auto input = readInput(aoc2025::embed::input);
+    return std::pair{solve1(input), solve2(input)};
+}();
+}  // namespace
+
+int main()
+{
+    fmt::println("day02.1: {}", answers.first);
+    fmt::println("day02.2: {}", answers.second);
+}
@@ -0,0 +1,543 @@
+#pragma once
+
+#include "util/input.h"
+#include "util/numeric.h"
+#include "util/parse.h"
+#include "util/smallvector.h"
+#include "util/trace.h"
+#include "util/algorithm.h"
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace aoc2025::day02
+{
+namespace rv = std::views;
+namespace rng = std::ranges;
+
+using Int = std::int64_t;
+using Range = std::pair<Int, Int>;
+constexpr auto trace = diagnostic::makeTracer<false>();
+
+constexpr auto isInvalid(Int value, int chunks)
+{
+    auto len = numerics::countDigits(value);
+    if (len % chunks != 0)
+        return false;
+
+    auto chunk = len / chunks;
+    auto chunkMask = numerics::pow10<Int>(chunk);
+    auto firstChunk = value % chunkMask;
+    value /= chunkMask;
+    while (value)
+    {
+        auto nextChunk = value % chunkMask;
+        if (nextChunk != firstChunk)
+            return false;
+        value /= chunkMask;
+    }
+    return true;
+};
+
+static_assert(isInvalid(1212, 2));
+static_assert(isInvalid(123123, 2));
+static_assert(isInvalid(123123123, 3));
+static_assert(isInvalid(1111, 4));
+static_assert(not isInvalid(1234, 2));
+static_assert(not isInvalid(1234, 4));
+
+
+constexpr auto maxDigits = std::numeric_limits<Int>::digits10 + 1;
+
+/**
+ * 1..01..01: `repeats` ones, `block` digits apart. A block repeated `repeats` times is
+ * the block times this.
+ */
+constexpr Int repunit(int block, int repeats)
+{
+    Int result = 0;
+    for (int i = 0; i < repeats; ++i)
+        result = result * numerics::pow10<Int>(block) + 1;
+    return result;
+}
+
+static_assert(repunit(2, 3) == 10101);
+
+constexpr containers::InplaceVector<int, 4> distinctPrimeFactors(int number)
+{
+    containers::InplaceVector<int, 4> result;
+    for (int prime = 2; number > 1; ++prime)
+    {
+        if (number % prime != 0)
+            continue;
+        result.push_back(prime);
+        while (number % prime == 0)
+            number /= prime;
+    }
+    return result;
+}
+
+static_assert(distinctPrimeFactors(12) == containers::InplaceVector<int, 4>{2, 3});
+
+/**
+ * Sum of the numbers in `range` made of a block of `block` digits repeated `repeats`
+ * times. Such a number is the block times the repunit, so the blocks in range form an
+ * interval and their sum is an arithmetic series.
+ */
+constexpr Int sumRepeated(const Range& range, int block, int repeats)
+{
+    auto repunit = day02::repunit(block, repeats);
+    auto first = std::max(numerics::pow10<Int>(block - 1),
+                          range.first / repunit + Int{range.first % repunit != 0});
+    auto last = std::min(numerics::pow10<Int>(block) - 1, range.second / repunit);
+    if (first > last)
+        return 0;
+    return (last - first + 1) * (first + last) / 2 * repunit;
+}
+
+static_assert(sumRepeated({11, 22}, 1, 2) == 11 + 22);
+static_assert(sumRepeated({95, 115}, 1, 3) == 111);
+static_assert(sumRepeated({1, 1'000'000}, 3, 2) == (100 + 999) * 900 / 2 * 1001);
+
+/**
+ * Sum of the numbers of `digits` digits in `range` that repeat any shorter block. Those
+ * repeating a block k times for a prime k cover all of them; numbers repeating at several
+ * periods are in several of these sets, so they are combined by inclusion-exclusion (a
+ * number repeated k1 and k2 times is repeated k1 * k2 times).
+ */
+constexpr Int sumAnyRepeated(const Range& range, int digits)
+{
+    auto primes = distinctPrimeFactors(digits);
+    auto count = std::size(primes);
+
+    Int result = 0;
+    for (unsigned subset = 1; subset < (1u << count); ++subset)
+    {
+        int repeats = 1;
+        for (std::size_t i = 0; i < count; ++i)
+            repeats *= (subset >> i & 1) != 0 ? primes[i] : 1;
+        auto sum = sumRepeated(range, digits / repeats, repeats);
+        result += std::popcount(subset) % 2 == 1 ? sum : -sum;
+    }
+    return result;
+}
+
+static_assert(sumAnyRepeated({1, 999'999}, 6) == sumRepeated({1, 999'999}, 3, 2)
+                                                      + sumRepeated({1, 999'999}, 2, 3)
+                                                      - sumRepeated({1, 999'999}, 1, 6));
+
+/**
+ * Both parts enumerate only the repeated numbers, digit length by digit length, so the
+ * cost does not depend on the width of the ranges.
+ */
+constexpr auto solve1(std::span<const Range> numbers)
+{
+    auto solveForRange = [](const Range& rng)
+    {
+        Int result = 0;
+        for (auto digits = numerics::countDigits(rng.first);
+             digits <= numerics::countDigits(rng.second);
+             ++digits)
+        {
+            if (digits % 2 == 0)
+                result += sumRepeated(rng, digits / 2, 2);
+        }
+        return result;
+    };
+    return algorithm::sum(numbers | rv::transform(solveForRange));
+}
+
+static_assert(solve1(std::to_array(  //
+                  {Range{11, 22},
+                   {95, 115},
+                   {998, 1012},
+                   {1188511880, 1188511890},
+                   {222220, 222224},
+                   {1698522, 1698528},
+                   {446443, 446449},
+                   {38593856, 38593862},
+                   {565653, 565659},
+                   {824824821, 824824827},
+                   {2121212118, 2121212124}}))
+              == 1227775554);
+
+
+constexpr auto solve2(std::span<const Range> numbers)
+{
+    auto solveForRange = [](const Range& rng)
+    {
+        Int result = 0;
+        for (auto digits = numerics::countDigits(rng.first);
+             digits <= numerics::countDigits(rng.second);
+             ++digits)
+        {
+            result += sumAnyRepeated(rng, digits);
+        }
+        return result;
+    };
+    return algorithm::sum(numbers | rv::transform(solveForRange));
+}
+
+static_assert(solve2(std::to_array(  //
+                  {Range{11, 22},
+                   {95, 115},
+                   {998, 1012},
+                   {1188511880, 1188511890},
+                   {222220, 222224},
+                   {1698522, 1698528},
+                   {446443, 446449},
+                   {38593856, 38593862},
+                   {565653, 565659},
+                   {824824821, 824824827},
+                   {2121212118, 2121212124}}))
+              == 4174379265);
+
+// Checks every number of the ranges, linear in their width, kept to verify the solvers
+namespace bruteforce
+{
+/**
+ * value % divisor == 0 for an odd divisor iff value * inverse < bound (mod 2^64), where
+ * inverse is the divisor's inverse mod 2^64: a multiplication instead of a division.
+ * The default test never matches.
+ */
+struct DivisibilityTest
+{
+    std::uint64_t inverse = 0;
+    std::uint64_t bound = 0;
+
+    constexpr bool matches(Int value) const
+    {
+        return static_cast<std::uint64_t>(value) * inverse < bound;
+    }
+};
+
+constexpr DivisibilityTest divisibilityTest(Int divisor)
+{
+    assert(divisor > 1 && divisor % 2 == 1 && "divisor must be odd");
+    auto odd = static_cast<std::uint64_t>(divisor);
+    auto inverse = odd;  // right in the lowest 3 bits, every Newton step doubles them
+    for (int i = 0; i < 5; ++i)
+        inverse *= 2 - odd * inverse;
+    return {inverse, std::numeric_limits<std::uint64_t>::max() / odd + 1};
+}
+
+static_assert(divisibilityTest(101).matches(1212));
+static_assert(not divisibilityTest(101).matches(1213));
+static_assert(divisibilityTest(1001).matches(0));
+
+/**
+ * isInvalid for numbers of a given length: a number of `digits` digits is its block
+ * repeated k times iff it is a multiple of repunit(digits / k, k). `twice` is part 1;
+ * part 2 needs only the prime k, a block repeated k1 * k2 times is also repeated k1
+ * times.
+ */
+struct RepeatTests
+{
+    DivisibilityTest twice;
+    std::array<DivisibilityTest, 2> prime;  // at most 19 digits, 2 distinct prime factors
+};
+
+// indexed by the number of digits, one past the longest Int for batches reaching it
+constexpr auto repeatTests = []
+{
+    std::array<RepeatTests, maxDigits + 2> result{};
+    for (int digits = 2; digits <= maxDigits; ++digits)
+    {
+        if (digits % 2 == 0)
+            result[digits].twice = divisibilityTest(repunit(digits / 2, 2));
+        auto primes = distinctPrimeFactors(digits);
+        for (std::size_t i = 0; i < std::size(primes); ++i)
+            result[digits].prime[i] = divisibilityTest(repunit(digits / primes[i], primes[i]));
+    }
+    return result;
+}();
+
+constexpr bool isRepeated(Int value, bool anyRepeats)
+{
+    const auto& tests = repeatTests[numerics::countDigits(value)];
+    return anyRepeats ? tests.prime[0].matches(value) || tests.prime[1].matches(value)
+                      : tests.twice.matches(value);
+}
+
+static_assert(
+    []
+    {
+        for (Int value = 0; value < 2'000; ++value)
+        {
+            auto any = rng::any_of(rv::iota(2, numerics::countDigits(value) + 1),
+                                   [&](int chunks) { return isInvalid(value, chunks); });
+            if (isRepeated(value, false) != isInvalid(value, 2) || isRepeated(value, true) != any)
+                return false;
+        }
+        return true;
+    }());
+
+constexpr std::size_t batchSize = 16;
+
+namespace detail
+{
+/**
+ * Vectorized prefix of invalidMask, returns how many values it classified. Consecutive
+ * values share their length, except those past the next power of 10.
+ */
+inline std::size_t invalidMaskVectorized(Int first,
+                                         std::size_t count,
+                                         bool anyRepeats,
+                                         std::uint32_t& mask)
+{
+    std::size_t k = 0;
+#if defined(__AVX512F__) && defined(__AVX512DQ__) || defined(__AVX2__)
+    auto digits = numerics::countDigits(first);
+    auto next = digits < maxDigits ? numerics::pow10<Int>(digits) : std::numeric_limits<Int>::max();
+    const auto& shorter = repeatTests[digits];
+    const auto& longer = repeatTests[digits + 1];
+    auto as = [](std::uint64_t value) { return static_cast<long long>(value); };
+    auto twice = [](const RepeatTests& tests) { return tests.twice; };
+    auto prime0 = [](const RepeatTests& tests) { return tests.prime[0]; };
+    auto prime1 = [](const RepeatTests& tests) { return tests.prime[1]; };
+#endif
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+    auto lanes = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+    auto matches = [&](auto test, __m512i values, __mmask8 isLonger)
+    {
+        auto inverse = _mm512_mask_blend_epi64(isLonger,
+                                               _mm512_set1_epi64(as(test(shorter).inverse)),
+                                               _mm512_set1_epi64(as(test(longer).inverse)));
+        auto bound = _mm512_mask_blend_epi64(isLonger,
+                                             _mm512_set1_epi64(as(test(shorter).bound)),
+                                             _mm512_set1_epi64(as(test(longer).bound)));
+        return _mm512_cmplt_epu64_mask(_mm512_mullo_epi64(values, inverse), bound);
+    };
+    for (; k + 8 <= count; k += 8)
+    {
+        auto values = _mm512_add_epi64(_mm512_set1_epi64(first + static_cast<Int>(k)), lanes);
+        auto isLonger = _mm512_cmpge_epi64_mask(values, _mm512_set1_epi64(next));
+        auto invalid = anyRepeats ? matches(prime0, values, isLonger)
+                                        | matches(prime1, values, isLonger)
+                                  : matches(twice, values, isLonger);
+        mask |= static_cast<std::uint32_t>(invalid) << k;
+    }
+#elif defined(__AVX2__)
+    // no 64-bit multiply and no unsigned compare: built from 32-bit products and a sign flip
+    auto multiply = [](__m256i lhs, __m256i rhs)
+    {
+        auto cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(lhs, 32), rhs),
+                                      _mm256_mul_epu32(lhs, _mm256_srli_epi64(rhs, 32)));
+        return _mm256_add_epi64(_mm256_mul_epu32(lhs, rhs), _mm256_slli_epi64(cross, 32));
+    };
+    auto sign = _mm256_set1_epi64x(std::numeric_limits<long long>::min());
+    auto lanes = _mm256_set_epi64x(3, 2, 1, 0);
+    auto matches = [&](auto test, __m256i values, __m256i isLonger)
+    {
+        auto inverse = _mm256_blendv_epi8(_mm256_set1_epi64x(as(test(shorter).inverse)),
+                                          _mm256_set1_epi64x(as(test(longer).inverse)),
+                                          isLonger);
+        auto bound = _mm256_blendv_epi8(_mm256_set1_epi64x(as(test(shorter).bound)),
+                                        _mm256_set1_epi64x(as(test(longer).bound)),
+                                        isLonger);
+        return _mm256_cmpgt_epi64(_mm256_xor_si256(bound, sign),
+                                  _mm256_xor_si256(multiply(values, inverse), sign));
+    };
+    for (; k + 4 <= count; k += 4)
+    {
+        auto values =
+            _mm256_add_epi64(_mm256_set1_epi64x(first + static_cast<Int>(k)), lanes);
+        auto isLonger = _mm256_cmpgt_epi64(values, _mm256_set1_epi64x(next - 1));
+        auto invalid = anyRepeats ? _mm256_or_si256(matches(prime0, values, isLonger),
+                                                    matches(prime1, values, isLonger))
+                                  : matches(twice, values, isLonger);
+        auto bits = _mm256_movemask_pd(_mm256_castsi256_pd(invalid));
+        mask |= static_cast<std::uint32_t>(bits) << k;
+    }
+#endif
+    return k;
+}
+}  // namespace detail
+
+/**
+ * Bit k is set if first + k is invalid: its block repeated twice, or any number of times
+ * with `anyRepeats`. For up to batchSize consecutive non-negative values, AVX-512/AVX2
+ * at runtime, scalar in constant evaluated context and for the tail.
+ */
+constexpr std::uint32_t invalidMask(Int first, std::size_t count, bool anyRepeats)
+{
+    assert(first >= 0 && count <= batchSize && "batch is out of range");
+    std::uint32_t mask = 0;
+    std::size_t k = 0;
+    if (not std::is_constant_evaluated())
+        k = detail::invalidMaskVectorized(first, count, anyRepeats, mask);
+    for (; k < count; ++k)
+        mask |= std::uint32_t{isRepeated(first + static_cast<Int>(k), anyRepeats)} << k;
+    return mask;
+}
+
+static_assert(invalidMask(95, batchSize, false) == 1u << 4);  // 99
+static_assert(invalidMask(95, batchSize, true) == 1u << 4);
+static_assert(invalidMask(100, batchSize, true) == 1u << 11);  // 111
+
+constexpr Int sumInvalid(const Range& range, bool anyRepeats)
+{
+    Int result = 0;
+    for (auto value = range.first; value <= range.second; value += batchSize)
+    {
+        auto last = std::min(range.second - value, static_cast<Int>(batchSize) - 1);
+        auto mask = invalidMask(value, static_cast<std::size_t>(last) + 1, anyRepeats);
+        for (; mask != 0; mask &= mask - 1)
+            result += value + std::countr_zero(mask);
+        if (value + last == range.second)
+            break;  // no overflow at the end of Int
+    }
+    return result;
+}
+
+/**
+ * Runs the SIMD batches against isInvalid around every power of 10 and at the end of
+ * Int, as the static_asserts only reach the scalar path. True when they agree.
+ */
+inline bool checkInvalidMask()
+{
+    auto reference = [](Int value, bool anyRepeats)
+    {
+        if (not anyRepeats)
+            return isInvalid(value, 2);
+        return rng::any_of(rv::iota(2, numerics::countDigits(value) + 1),
+                           [&](int chunks) { return isInvalid(value, chunks); });
+    };
+    auto agrees = [&](Int first, std::size_t count)
+    {
+        for (auto anyRepeats : {false, true})
+        {
+            auto mask = invalidMask(first, count, anyRepeats);
+            for (std::size_t k = 0; k < count; ++k)
+            {
+                auto invalid = reference(first + static_cast<Int>(k), anyRepeats);
+                if (((mask >> k & 1) != 0) != invalid)
+                    return false;
+            }
+        }
+        return true;
+    };
+
+    // batches starting before, across and after the length changes
+    for (int digits = 1; digits < maxDigits; ++digits)
+    {
+        auto power = numerics::pow10<Int>(digits);
+        for (auto first = std::max<Int>(power - 2 * batchSize, 0); first <= power + 2; ++first)
+        {
+            for (std::size_t count = 1; count <= batchSize; ++count)
+            {
+                if (not agrees(first, count))
+                    return false;
+            }
+        }
+    }
+    // batches around numbers repeated only a prime number of times, e.g. 101101
+    constexpr auto batch = static_cast<Int>(batchSize);
+    for (int digits = 2; digits <= maxDigits; ++digits)
+    {
+        for (auto prime : distinctPrimeFactors(digits))
+        {
+            auto length = digits / prime;
+            auto block = numerics::pow10<Int>(length - 1) + 1;
+            auto value = block * repunit(length, prime);
+            for (auto first = value - batch + 1; first <= value; ++first)
+            {
+                if (not agrees(first, batchSize))
+                    return false;
+            }
+        }
+    }
+    constexpr auto max = std::numeric_limits<Int>::max();
+    for (auto first = max - 2 * batch; first <= max - batch + 1; ++first)
+    {
+        if (not agrees(first, batchSize))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Splits the ranges into pieces of at most total width / `pieces` numbers, so threads
+ * get the same amount of work however different the widths of the ranges are.
+ */
+constexpr std::vector<Range> balancedPieces(std::span<const Range> ranges, std::size_t pieces)
+{
+    Int total = 0;
+    for (const auto& [first, last] : ranges)
+        total += last - first + 1;
+    auto parts = static_cast<Int>(pieces);
+    auto width = std::max<Int>(1, (total + parts - 1) / parts);
+
+    std::vector<Range> result;
+    for (auto [first, last] : ranges)
+    {
+        for (; last - first >= width; first += width)
+            result.emplace_back(first, first + width - 1);
+        result.emplace_back(first, last);
+    }
+    return result;
+}
+
+static_assert(balancedPieces(std::array{Range{1, 10}, Range{20, 21}}, 3)
+              == std::vector{Range{1, 4}, Range{5, 8}, Range{9, 10}, Range{20, 21}});
+
+constexpr auto solve1(std::span<const Range> numbers)
+{
+    return algorithm::parallelTransformReduce(  //
+        balancedPieces(numbers, parallel::maxChunks),
+        Int{0},
+        std::plus<>{},
+        [](const Range& piece) { return sumInvalid(piece, false); });
+}
+
+constexpr auto solve2(std::span<const Range> numbers)
+{
+    return algorithm::parallelTransformReduce(  //
+        balancedPieces(numbers, parallel::maxChunks),
+        Int{0},
+        std::plus<>{},
+        [](const Range& piece) { return sumInvalid(piece, true); });
+}
+}  // namespace bruteforce
+
+static_assert(
+    []
+    {
+        // across digit lengths and periods
+        auto ranges = std::to_array(  //
+            {Range{1, 2'000},
+             {111'000, 112'000},
+             {1188511880, 1188511890},
+             {2121212118, 2121212124}});
+        return solve1(ranges) == bruteforce::solve1(ranges)
+               && solve2(ranges) == bruteforce::solve2(ranges);
+    }());
+
+constexpr std::vector<Range> readInput(std::string_view content)
+{
+    auto lines = input::lines(content);
+    if (std::ranges::empty(lines))
+        return {};
+
+    return parse::parseIntegers<Int>(*std::begin(lines))
+           | rv::chunk(2)
+           | rv::transform([](auto pair) -> Range { return {pair[0], pair[1]}; })
+           | rng::to<std::vector>();
+}
+
+}  // namespace aoc2025::day02
@@ -1,140 +1,26 @@
-#include "util/numeric.h"
+#include "day02.h"
+
+#include "util/input.h"
 #include "util/stopwatch.h"
-#include "util/trace.h"
-#include "util/algorithm.h"
 
 #include <fmt/format.h>
-#include <fmt/ranges.h>
 #include <fmt/chrono.h>
 
-#include <ctre.hpp>
-
-#include <array>
-#include <cassert>
-#include <cstdint>
-#include <fstream>
-#include <functional>
-#include <ranges>
-#include <span>
-#include <utility>
-#include <vector>
-
-namespace aoc2025::day02
-{
-namespace rv = std::views;
-namespace rng = std::ranges;
-
-using Int = std::int64_t;
-using Range = std::pair<Int, Int>;
-constexpr auto trace = diagnostic::makeTracer<false>();
-
-constexpr auto isInvalid(Int value, int chunks)
-{
-    auto len = numerics::countDigits(value);
-    if (len % chunks != 0)
-        return false;
-
-    auto chunk = len / chunks;
-    auto chunkMask = numerics::pow10<Int>(chunk);
-    auto firstChunk = value % chunkMask;
-    value /= chunkMask;
-    while (value)
-    {
-        auto nextChunk = value % chunkMask;
-        if (nextChunk != firstChunk)
-            return false;
-        value /= chunkMask;
-    }
-    return true;
-};
-
-static_assert(isInvalid(1212, 2));
-static_assert(isInvalid(123123, 2));
-static_assert(isInvalid(123123123, 3));
-static_assert(isInvalid(1111, 4));
-static_assert(not isInvalid(1234, 2));
-static_assert(not isInvalid(1234, 4));
-
-
-constexpr auto solve1(std::span<const Range> numbers)
-{
-    auto solveForRange = [](const Range& rng)
-    {
-        return algorithm::sum(  //
-            rv::iota(rng.first, rng.second + 1)
-            | rv::filter(std::bind_back(isInvalid, 2)));
-    };
-    return algorithm::sum(numbers | rv::transform(solveForRange));
-}
-
-static_assert(solve1(std::to_array(  //
-                  {Range{11, 22},
-                   {95, 115},
-                   {998, 1012},
-                   {1188511880, 1188511890},
-                   {222220, 222224},
-                   {1698522, 1698528},
-                   {446443, 446449},
-                   {38593856, 38593862},
-                   {565653, 565659},
-                   {824824821, 824824827},
-                   {2121212118, 2121212124}}))
-              == 1227775554);
-
-
-constexpr auto solve2(std::span<const Range> numbers)
-{
-    namespace rv = std::views;
-
-    auto solveForRange = [&](const Range& rng)
-    {
-        return algorithm::sum(  //
-            rv::iota(rng.first, rng.second + 1)
-            | rv::filter(
-                [](auto value)
-                {
-                    return rng::any_of(rv::iota(2, numerics::countDigits(value) + 1),
-                                       std::bind_front(isInvalid, value));
-                }));
-    };
-    return algorithm::sum(numbers | rv::transform(solveForRange));
-}
-
-static_assert(solve2(std::to_array(  //
-                  {Range{11, 22},
-                   {95, 115},
-                   {998, 1012},
-                   {1188511880, 1188511890},
-                   {222220, 222224},
-                   {1698522, 1698528},
-                   {446443, 446449},
-                   {38593856, 38593862},
-                   {565653, 565659},
-                   {824824821, 824824827},
-                   {2121212118, 2121212124}}))
-              == 4174379265);
-
-}  // namespace aoc2025::day02
-
 int main()
 {
     using namespace aoc2025::day02;
-    std::ifstream file("./input.txt");
-    std::string line;
-    if (not file || not std::getline(file, line))
+    auto file = aoc2025::input::InputFile::open("./input.txt");
+    if (not file)
+    {
+        fmt::println("Failed to read input file");
+        return 1;
+    }
+    auto input = readInput(file->content());
+    if (std::empty(input))
     {
         fmt::println("Failed to read input file");
         return 1;
     }
-    auto input = ctre::search_all<R"(([0-9]+)-([0-9]+))">(line)
-                 | rv::transform(
-                     [](auto match) -> Range
-                     {
-                         auto [_, left, right] = match;
-                         return {left.template to_number<Int>(),
-                                 right.template to_number<Int>()};
-                     })
-                 | rng::to<std::vector>();
 
     aoc2025::time::Stopwatch<> stopwatch;
     fmt::println("day01.solution1: {}", solve1(input));
@@ -142,4 +28,4 @@ int main()
     stopwatch = {};
     fmt::println("day01.solution2: {}", solve2(input));
     fmt::println("Time elapsed: {}", stopwatch.elapsed());
-}
\ No newline at end of file
+}
@@ -0,0 +1,35 @@
+#include "day02.h"
+
+#include "util/registry.h"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace aoc2025::day02
+{
+namespace
+{
+const registry::Registrar registrar{{
+    .name = "day02",
+    .day = 2,
+    .load =
+        [](std::string_view content)
+    {
+        auto input = std::make_shared<const std::vector<Range>>(readInput(content));
+        return std::vector{
+            registry::makePart(1, [input] { return solve1(*input); }),
+            registry::makePart(2, [input] { return solve2(*input); }),
+        };
+    },
+    .selfCheck = bruteforce::checkInvalidMask,
+    .crossCheck =
+        [](std::string_view content)
+    {
+        auto input = readInput(content);
+        return solve1(input) == bruteforce::solve1(input)
+               && solve2(input) == bruteforce::solve2(input);
+    },
+}};
+}  // namespace
+}  // namespace aoc2025::day02
@@ -0,0 +1,25 @@
+#include "day03.h"
+
+#include "util/embed.h"
+
+#include <fmt/format.h>
+
+#include <span>
+#include <utility>
+
+namespace
+{
+using namespace aoc2025::day03;
+
+constexpr auto answers = []
+{
+    auto input = readInput(aoc2025::embed::input);
+    return std::pair{solve1(std::span{input}), solve2(std::span{input})};
+}();
+}  // namespace
+
+int main()
+{
+    fmt::println("day03.1: {}", answers.first);
+    fmt::println("day03.2: {}", answers.second);
+}
@@ -0,0 +1,420 @@
+#pragma once
+
+#include "util/algorithm.h"
+#include "util/input.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <span>
+#include <ranges>
+#include <vector>
+#include <functional>
+
+namespace aoc2025::day03
+{
+constexpr std::uint8_t toInt(char ch)
+{
+    assert(ch >= '0' && ch <= '9' && "character must be a digit");
+    return static_cast<std::uint8_t>(ch - '0');
+}
+
+static_assert(toInt('0') == 0);
+static_assert(toInt('5') == 5);
+static_assert(toInt('9') == 9);
+
+
+// We will work with string-view for simpler input
+template <class T>
+concept StringLike = std::same_as<std::remove_cvref_t<T>, std::string_view>
+                     || std::constructible_from<std::string_view, T>;
+
+// Initial solution for #1: not used anymore
+constexpr std::uint64_t maxJoltage(const StringLike auto& bank)
+{
+    std::string_view sv = bank;
+    assert(std::size(sv) >= 2 && "bank must have at least two digits");
+    auto first = std::max_element(std::begin(sv), std::prev(std::rbegin(sv).base()));
+    auto second = std::max_element(std::next(first), std::end(sv));
+    return toInt(*first) * 10 + toInt(*second);
+}
+
+static_assert(maxJoltage("123456789") == 89);
+static_assert(maxJoltage("163841689525773") == 97);
+static_assert(maxJoltage("0000000000") == 0);
+static_assert(maxJoltage("811111111111119") == 89);
+
+
+namespace detail
+{
+// One step of maxJoltageDigits, `drops` is the number of digits that may still be skipped
+constexpr void pushDigit(std::span<char> stack, std::size_t& size, std::size_t& drops, char ch)
+{
+    for (; size > 0 && drops > 0 && stack[size - 1] < ch; --drops)
+        --size;
+    if (size < std::size(stack))
+        stack[size++] = ch;
+    else
+        --drops;
+}
+}  // namespace detail
+
+/**
+ * Writes the largest number made of std::size(out) digits of the bank, kept in order, to
+ * `out`, which serves as a monotonic stack: a digit pops smaller digits while enough
+ * digits are left to fill the stack again. Every digit is pushed and popped at most
+ * once, so this is linear in the bank and needs no memory but `out`.
+ */
+constexpr void maxJoltageDigits(std::string_view bank, std::span<char> out)
+{
+    assert(std::size(bank) >= std::size(out) && "bank is too small");
+    auto drops = std::size(bank) - std::size(out);
+    std::size_t size = 0;
+    for (auto ch : bank)
+        detail::pushDigit(out, size, drops, ch);
+}
+
+/**
+ * maxJoltageDigits for any n, as a string of digits.
+ */
+constexpr std::string maxJoltageString(const StringLike auto& bank, std::size_t n)
+{
+    std::string result(n, '0');
+    maxJoltageDigits(bank, result);
+    return result;
+}
+
+static_assert(maxJoltageString("818181911112111", 12) == "888911112111");
+static_assert(maxJoltageString("818181911112111", 15) == "818181911112111");
+static_assert(maxJoltageString("12345678909876543210123456789", 20) == "99876543210123456789");
+
+constexpr auto maxFastDigits = std::numeric_limits<std::uint64_t>::digits10;  // 19
+
+constexpr std::uint64_t toNumber(std::string_view digits)
+{
+    assert(std::size(digits) <= maxFastDigits && "number does not fit");
+    return std::ranges::fold_left(
+        digits, std::uint64_t{0}, [](auto result, char ch) { return result * 10 + toInt(ch); });
+}
+
+constexpr std::uint64_t maxJoltageN(const StringLike auto& bank, std::uint8_t n)
+{
+    assert(n <= maxFastDigits && "use maxJoltageString for longer numbers");
+    std::array<char, maxFastDigits> digits{};
+    maxJoltageDigits(bank, std::span{digits}.first(n));
+    return toNumber({std::data(digits), n});
+}
+static_assert(maxJoltageN("987654321111111", 12) == 987654321111);
+static_assert(maxJoltageN("811111111111119", 12) == 811111111119);
+static_assert(maxJoltageN("234234234234278", 12) == 434234234278);
+static_assert(maxJoltageN("818181911112111", 12) == 888911112111);
+
+/**
+ * maxJoltageDigits over a bank fed in blocks of any size, for banks too large to hold
+ * in memory, with 2n bytes of state. The stack only has to hold back pops within the
+ * last n digits of the bank, so those are delayed in a ring until finish() and every
+ * digit before them is pushed with unlimited pops.
+ */
+class JoltageStream
+{
+public:
+    constexpr explicit JoltageStream(std::size_t n)
+        : stack_(n, '0')
+        , delayed_(n, '0')
+    {
+        assert(n > 0 && "nothing to pick");
+    }
+
+    constexpr bool empty() const { return received_ == 0; }
+
+    constexpr void feed(std::string_view block)
+    {
+        for (auto ch : block)
+        {
+            if (received_++ >= std::size(delayed_))
+            {
+                auto unlimited = std::numeric_limits<std::size_t>::max();
+                detail::pushDigit(stack_, size_, unlimited, delayed_[oldest_]);
+            }
+            delayed_[oldest_] = ch;
+            oldest_ = oldest_ + 1 == std::size(delayed_) ? 0 : oldest_ + 1;
+        }
+    }
+
+    /**
+     * The n digits of the bank fed so far, valid until the next feed. The stream is
+     * ready for the next bank afterwards.
+     */
+    constexpr std::string_view finish()
+    {
+        assert(received_ >= std::size(delayed_) && "bank is too small");
+        auto drops = size_;  // (length - n) - (length - n - size_) skipped so far
+        for (std::size_t i = 0; i < std::size(delayed_); ++i)
+        {
+            auto ch = delayed_[(oldest_ + i) % std::size(delayed_)];
+            detail::pushDigit(stack_, size_, drops, ch);
+        }
+
+        received_ = size_ = oldest_ = 0;
+        return stack_;
+    }
+
+private:
+    std::string stack_;
+    std::string delayed_;  // ring of the last n digits, oldest_ is the next to leave
+    std::size_t size_ = 0;
+    std::size_t received_ = 0;
+    std::size_t oldest_ = 0;
+};
+
+static_assert(
+    []
+    {
+        JoltageStream stream{12};
+        for (std::string_view bank :
+             {"987654321111111", "811111111111119", "234234234234278", "818181911112111"})
+        {
+            for (std::size_t block = 1; block <= std::size(bank); ++block)
+            {
+                for (std::size_t first = 0; first < std::size(bank); first += block)
+                    stream.feed(bank.substr(first, block));
+                if (toNumber(stream.finish()) != maxJoltageN(bank, 12))
+                    return false;
+            }
+        }
+        return true;
+    }());
+static_assert(
+    []
+    {
+        JoltageStream stream{20};
+        stream.feed("1234567890987654");
+        stream.feed("3210123456789");
+        return stream.finish() == maxJoltageString("12345678909876543210123456789", 20);
+    }());
+
+#if defined(__AVX2__)
+constexpr std::size_t bankLanes = 32;
+#else
+constexpr std::size_t bankLanes = 16;
+#endif
+constexpr std::size_t maxLaneBank = 255;  // positions are kept in bytes
+
+namespace detail
+{
+#if defined(__AVX2__) || defined(__SSE2__)
+constexpr bool vectorizedLanes = true;
+#else
+constexpr bool vectorizedLanes = false;
+#endif
+
+/**
+ * maxJoltageN of bankLanes banks of the same length at once, one bank per byte lane:
+ * `columns` holds the banks transposed, digit p of every bank in columns[p]. Every
+ * window is scanned for all lanes together with byte-wise compares and blends, lanes
+ * ignore positions before their previous pick. Returns false without SIMD.
+ */
+inline bool maxJoltageLanes(std::span<const std::array<char, bankLanes>> columns,
+                            std::uint8_t n,
+                            std::span<std::uint64_t, bankLanes> out)
+{
+#if defined(__AVX2__) || defined(__SSE2__)
+    assert(std::size(columns) <= maxLaneBank && std::size(columns) >= n && "bank length");
+#if defined(__AVX2__)
+    using Vector = __m256i;
+    auto load = [](const char* data)
+    { return _mm256_loadu_si256(reinterpret_cast<const Vector*>(data)); };
+    auto store = [](void* data, Vector value)
+    { _mm256_storeu_si256(static_cast<Vector*>(data), value); };
+    auto broadcast = [](std::size_t value) { return _mm256_set1_epi8(static_cast<char>(value)); };
+    auto notBefore = [](Vector first, Vector position)  // first <= position, unsigned
+    { return _mm256_cmpeq_epi8(_mm256_max_epu8(first, position), position); };
+    auto greater = [](Vector lhs, Vector rhs) { return _mm256_cmpgt_epi8(lhs, rhs); };
+    auto both = [](Vector lhs, Vector rhs) { return _mm256_and_si256(lhs, rhs); };
+    auto blend = [](Vector old, Vector value, Vector mask)
+    { return _mm256_blendv_epi8(old, value, mask); };
+    auto add = [](Vector lhs, Vector rhs) { return _mm256_add_epi8(lhs, rhs); };
+#else
+    using Vector = __m128i;
+    auto load = [](const char* data)
+    { return _mm_loadu_si128(reinterpret_cast<const Vector*>(data)); };
+    auto store = [](void* data, Vector value)
+    { _mm_storeu_si128(static_cast<Vector*>(data), value); };
+    auto broadcast = [](std::size_t value) { return _mm_set1_epi8(static_cast<char>(value)); };
+    auto notBefore = [](Vector first, Vector position)
+    { return _mm_cmpeq_epi8(_mm_max_epu8(first, position), position); };
+    auto greater = [](Vector lhs, Vector rhs) { return _mm_cmpgt_epi8(lhs, rhs); };
+    auto both = [](Vector lhs, Vector rhs) { return _mm_and_si128(lhs, rhs); };
+    auto blend = [](Vector old, Vector value, Vector mask)  // no blendv before SSE4.1
+    { return _mm_or_si128(_mm_and_si128(mask, value), _mm_andnot_si128(mask, old)); };
+    auto add = [](Vector lhs, Vector rhs) { return _mm_add_epi8(lhs, rhs); };
+#endif
+    static_assert(sizeof(Vector) == bankLanes);
+
+    std::ranges::fill(out, 0);
+    auto first = broadcast(0);
+    std::size_t lowestFirst = 0;
+    std::array<std::uint8_t, bankLanes> values{};
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        // digits are positive as signed bytes, so zero is below all of them
+        auto best = broadcast(0);
+        auto bestPosition = broadcast(0);
+        for (auto p = lowestFirst; p + n <= std::size(columns) + i; ++p)
+        {
+            auto position = broadcast(p);
+            auto digits = load(std::data(columns[p]));
+            auto take = both(notBefore(first, position), greater(digits, best));
+            best = blend(best, digits, take);
+            bestPosition = blend(bestPosition, position, take);
+        }
+        first = add(bestPosition, broadcast(1));
+
+        store(std::data(values), first);
+        lowestFirst = std::ranges::min(values);
+        store(std::data(values), best);
+        for (std::size_t lane = 0; lane < bankLanes; ++lane)
+            out[lane] = out[lane] * 10 + toInt(static_cast<char>(values[lane]));
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+}  // namespace detail
+
+/**
+ * Sum of maxJoltageN over the banks. Runs of bankLanes banks of the same (short) length
+ * are transposed into SIMD lanes and solved together, ragged groups are solved one bank
+ * at a time. Groups are spread over threads.
+ */
+template <StringLike T>
+constexpr std::uint64_t sumMaxJoltage(std::span<T> banks, std::uint8_t n)
+{
+    auto groups = (std::size(banks) + bankLanes - 1) / bankLanes;
+    auto solveGroup = [&](std::size_t group) -> std::uint64_t
+    {
+        auto members = banks.subspan(group * bankLanes,
+                                     std::min(bankLanes, std::size(banks) - group * bankLanes));
+        auto length = std::size(std::string_view{members.front()});
+        auto sameLength = [&](const auto& bank)
+        { return std::size(std::string_view{bank}) == length; };
+        auto transposable = std::size(members) == bankLanes && length <= maxLaneBank
+                            && length >= n && std::ranges::all_of(members, sameLength);
+        if (detail::vectorizedLanes && not std::is_constant_evaluated() && transposable)
+        {
+            std::array<std::array<char, bankLanes>, maxLaneBank> columns;
+            for (std::size_t lane = 0; lane < bankLanes; ++lane)
+            {
+                std::string_view bank = members[lane];
+                for (std::size_t p = 0; p < length; ++p)
+                    columns[p][lane] = bank[p];
+            }
+            std::array<std::uint64_t, bankLanes> values;
+            if (detail::maxJoltageLanes(std::span{columns}.first(length), n, values))
+                return algorithm::sum(values);
+        }
+        return algorithm::sum(members
+                              | std::views::transform([n](const auto& bank)
+                                                      { return maxJoltageN(bank, n); }));
+    };
+    return algorithm::parallelSum(std::views::iota(std::size_t{0}, groups)
+                                  | std::views::transform(solveGroup));
+}
+
+/**
+ * Runs the SIMD lanes against maxJoltageN on generated banks of several lengths, as
+ * the static_asserts only reach the scalar path. True when they agree (or without SIMD).
+ */
+inline bool checkMaxJoltageLanes()
+{
+    if constexpr (not detail::vectorizedLanes)
+        return true;
+
+    std::uint64_t state = 2025;  // xorshift, the digits only need to vary
+    std::array<std::string, bankLanes> banks;
+    std::array<std::array<char, bankLanes>, maxLaneBank> columns;
+    std::array<std::uint64_t, bankLanes> values;
+    for (std::size_t length : {2uz, 12uz, 15uz, 100uz, maxLaneBank})
+    {
+        for (std::size_t lane = 0; lane < bankLanes; ++lane)
+        {
+            banks[lane].resize(length);
+            for (std::size_t p = 0; p < length; ++p)
+            {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                banks[lane][p] = columns[p][lane] = static_cast<char>('1' + state % 9);
+            }
+        }
+        for (std::uint8_t n : {1, 2, 12})
+        {
+            if (n > length)
+                continue;
+            detail::maxJoltageLanes(std::span{columns}.first(length), n, values);
+            for (std::size_t lane = 0; lane < bankLanes; ++lane)
+            {
+                if (values[lane] != maxJoltageN(banks[lane], n))
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <StringLike T>
+constexpr std::uint64_t solve1(std::span<T> banks)
+{
+    return sumMaxJoltage(banks, 2);
+}
+
+static_assert(
+    []
+    {
+        using std::string_view_literals::operator""sv;
+
+        std::array input{"987654321111111"sv,
+                         "811111111111119"sv,
+                         "234234234234278"sv,
+                         "818181911112111"sv};
+        return solve1(std::span{std::begin(input), std::end(input)});
+    }()
+    == 98 + 89 + 78 + 92);
+
+
+template <StringLike T>
+constexpr std::uint64_t solve2(std::span<T> banks)
+{
+    return sumMaxJoltage(banks, 12);
+}
+
+static_assert(
+    []
+    {
+        using std::string_view_literals::operator""sv;
+
+        std::array input{"987654321111111"sv,
+                         "811111111111119"sv,
+                         "234234234234278"sv,
+                         "818181911112111"sv};
+        return solve2(std::span{std::begin(input), std::end(input)});
+    }()
+    == 987654321111 + 811111111119 + 434234234278 + 888911112111);
+
+// Banks are views into the input content, which has to outlive them
+constexpr std::vector<std::string_view> readInput(std::string_view content)
+{
+    return input::tokens(content) | std::ranges::to<std::vector>();
+}
+
+}  // namespace aoc2025::day03
@@ -0,0 +1,28 @@
+#include "day03.h"
+
+#include "util/registry.h"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace aoc2025::day03
+{
+namespace
+{
+const registry::Registrar registrar{{
+    .name = "day03",
+    .day = 3,
+    .load =
+        [](std::string_view content)
+    {
+        auto input = std::make_shared<const std::vector<std::string_view>>(readInput(content));
+        return std::vector{
+            registry::makePart(1, [input] { return solve1(std::span{*input}); }),
+            registry::makePart(2, [input] { return solve2(std::span{*input}); }),
+        };
+    },
+    .selfCheck = checkMaxJoltageLanes,
+}};
+}  // namespace
+}  // namespace aoc2025::day03
@@ -0,0 +1,24 @@
+#include "day04.h"
+
+#include "util/embed.h"
+
+#include <fmt/format.h>
+
+#include <utility>
+
+namespace
+{
+using namespace aoc2025::day04;
+
+constexpr auto answers = []
+{
+    auto input = readInput(aoc2025::embed::input);
+    return std::pair{solve1(input), solve2(std::move(input))};
+}();
+}  // namespace
+
+int main()
+{
+    fmt::println("day04.1: {}", answers.first);
+    fmt::println("day04.2: {}", answers.second);
+}
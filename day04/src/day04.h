@@ -0,0 +1,527 @@
+#pragma once
+
+#include "util/algorithm.h"
+#include "util/input.h"
+#include "util/parallel.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+
+namespace aoc2025::day04
+{
+/**
+ * The grid with one bit per cell, set for a roll, 64 cells per word. Rows are padded to
+ * whole words and framed by an empty row above and below, so neighbours of every cell
+ * can be read without bounds checks.
+ */
+class BitGrid
+{
+public:
+    template <std::ranges::forward_range R>
+    constexpr BitGrid(R&& rows)  // implicit, grids are written as rows of text
+        : height_(static_cast<std::size_t>(std::ranges::distance(rows)))
+        , width_(height_ == 0 ? 0 : std::size(std::string_view{*std::ranges::begin(rows)}))
+        , stride_((width_ + 63) / 64)
+        , words_((height_ + 2) * stride_)
+    {
+        std::size_t i = 0;
+        for (auto&& line : rows)
+        {
+            std::string_view text = line;
+            assert(std::size(text) == width_ && "rows must have the same width");
+            auto words = row(i++);
+            for (std::size_t j = 0; j < width_; ++j)
+                words[j / 64] |= std::uint64_t{text[j] == '@'} << (j % 64);
+        }
+    }
+
+    constexpr std::size_t height() const { return height_; }
+    constexpr std::size_t width() const { return width_; }
+    constexpr std::size_t stride() const { return stride_; }
+
+    /**
+     * Words of row i, -1 and height() are the empty frame.
+     */
+    constexpr std::span<std::uint64_t> row(std::ptrdiff_t i)
+    {
+        return std::span{words_}.subspan(static_cast<std::size_t>(i + 1) * stride_, stride_);
+    }
+    constexpr std::span<const std::uint64_t> row(std::ptrdiff_t i) const
+    {
+        return std::span{words_}.subspan(static_cast<std::size_t>(i + 1) * stride_, stride_);
+    }
+
+    /**
+     * Whether cell (i, j) holds a roll, false outside of the grid.
+     */
+    constexpr bool roll(std::ptrdiff_t i, std::ptrdiff_t j) const
+    {
+        if (j < 0 || j >= static_cast<std::ptrdiff_t>(width_))
+            return false;
+        auto column = static_cast<std::size_t>(j);
+        return (row(i)[column / 64] >> (column % 64) & 1) != 0;
+    }
+
+    /**
+     * Rolls in the 3x3 block centred on cell (i, j) of the grid.
+     */
+    constexpr int block(std::ptrdiff_t i, std::ptrdiff_t j) const
+    {
+        auto column = static_cast<std::size_t>(j);
+        auto word = column / 64;
+        auto bit = column % 64;
+        auto count = 0;
+        for (auto di : {-1, 0, 1})
+        {
+            auto words = row(i + di);
+            // cells j - 1 .. j + 1 moved to bits 0 .. 2
+            auto cells = bit == 0 ? words[word] << 1 : words[word] >> (bit - 1);
+            if (bit == 0 && word > 0)
+                cells |= words[word - 1] >> 63;
+            if (bit == 63 && word + 1 < stride_)
+                cells |= words[word + 1] << 2;
+            count += std::popcount(cells & 7);
+        }
+        return count;
+    }
+
+    constexpr void removeRoll(std::ptrdiff_t i, std::ptrdiff_t j)
+    {
+        auto column = static_cast<std::size_t>(j);
+        row(i)[column / 64] &= ~(std::uint64_t{1} << (column % 64));
+    }
+
+    constexpr std::int64_t rollCount() const
+    {
+        std::int64_t result = 0;
+        for (auto word : words_)
+            result += std::popcount(word);
+        return result;
+    }
+
+    constexpr bool operator==(const BitGrid&) const = default;
+
+private:
+    std::size_t height_ = 0;
+    std::size_t width_ = 0;
+    std::size_t stride_ = 0;
+    std::vector<std::uint64_t> words_;
+};
+
+namespace detail
+{
+constexpr std::uint64_t majority(std::uint64_t a, std::uint64_t b, std::uint64_t c)
+{
+    return (a & b) | (c & (a ^ b));
+}
+}  // namespace detail
+
+/**
+ * Rolls of `middle` with fewer than 4 rolls among their 8 neighbours, 64 cells at a
+ * time. The neighbours are the three rows shifted by a column, summed by bit-sliced
+ * adders: the sum is ones + 2 * (number of carries), so it reaches 4 iff at least two
+ * of the four carries are set. No branch per cell.
+ */
+constexpr void accessibleRolls(std::span<const std::uint64_t> above,
+                               std::span<const std::uint64_t> middle,
+                               std::span<const std::uint64_t> below,
+                               std::span<std::uint64_t> out)
+{
+    auto size = std::size(middle);
+    for (std::size_t w = 0; w < size; ++w)
+    {
+        // bit j of `left` is cell j - 1, of `right` cell j + 1
+        auto left = [&](std::span<const std::uint64_t> row)
+        { return row[w] << 1 | (w > 0 ? row[w - 1] >> 63 : 0); };
+        auto right = [&](std::span<const std::uint64_t> row)
+        { return row[w] >> 1 | (w + 1 < size ? row[w + 1] << 63 : 0); };
+
+        auto aboveLeft = left(above);
+        auto aboveRight = right(above);
+        auto belowLeft = left(below);
+        auto belowRight = right(below);
+        auto middleLeft = left(middle);
+        auto middleRight = right(middle);
+
+        auto aboveOnes = aboveLeft ^ above[w] ^ aboveRight;
+        auto aboveTwos = detail::majority(aboveLeft, above[w], aboveRight);
+        auto belowOnes = belowLeft ^ below[w] ^ belowRight;
+        auto belowTwos = detail::majority(belowLeft, below[w], belowRight);
+        auto middleOnes = middleLeft ^ middleRight;
+        auto middleTwos = middleLeft & middleRight;
+        auto onesTwos = detail::majority(aboveOnes, belowOnes, middleOnes);
+
+        auto atLeastTwoTwos = (aboveTwos & belowTwos) | (middleTwos & onesTwos)
+                              | ((aboveTwos | belowTwos) & (middleTwos | onesTwos));
+        out[w] = middle[w] & ~atLeastTwoTwos;
+    }
+}
+
+namespace detail
+{
+// Rows per tile of the parallel loops, enough to amortize the two halo rows
+constexpr std::size_t tileRows = 64;
+
+constexpr std::size_t tileCount(std::size_t height)
+{
+    return std::clamp(height / tileRows, std::size_t{1}, parallel::maxChunks);
+}
+
+/**
+ * Rows [first, last) of the grid with private copies of the rows above and below it
+ * (halos), so tiles can be updated in place while their neighbours are.
+ */
+struct Tile
+{
+    std::ptrdiff_t first = 0;
+    std::ptrdiff_t last = 0;
+    std::vector<std::uint64_t> above;
+    std::vector<std::uint64_t> below;
+    std::vector<std::uint64_t> previous;  // the row before the current one, not yet cleared
+    std::vector<std::uint64_t> accessible;
+    std::int64_t removed = 0;
+};
+
+/**
+ * One round over the rows of a tile, returns how many rolls were removed. Rows are
+ * cleared in place, but `previous` keeps the row above as it was before, so the round
+ * sees the grid as it was at its start.
+ */
+constexpr std::int64_t removeInTile(BitGrid& grid, Tile& tile)
+{
+    std::ranges::copy(tile.above, std::begin(tile.previous));
+    std::int64_t removed = 0;
+    for (auto i = tile.first; i < tile.last; ++i)
+    {
+        auto words = grid.row(i);
+        std::span<const std::uint64_t> below = i + 1 < tile.last ? grid.row(i + 1) : tile.below;
+        accessibleRolls(tile.previous, words, below, tile.accessible);
+        std::ranges::copy(words, std::begin(tile.previous));
+        for (std::size_t w = 0; w < std::size(words); ++w)
+        {
+            removed += std::popcount(tile.accessible[w]);
+            words[w] &= ~tile.accessible[w];
+        }
+    }
+    return removed;
+}
+
+/**
+ * Copies a row into its halo, returns whether the halo changed.
+ */
+constexpr bool refreshHalo(std::vector<std::uint64_t>& halo, std::span<const std::uint64_t> row)
+{
+    if (std::ranges::equal(halo, row))
+        return false;
+    std::ranges::copy(row, std::begin(halo));
+    return true;
+}
+
+/**
+ * Splits the grid into tileCount() tiles with their halos and row buffers.
+ */
+constexpr std::vector<Tile> makeTiles(const BitGrid& grid)
+{
+    auto count = tileCount(grid.height());
+    std::vector<Tile> tiles(count);
+    for (std::size_t t = 0; t < count; ++t)
+    {
+        auto [first, last] = parallel::chunkBounds(grid.height(), count, t);
+        auto& tile = tiles[t];
+        tile.first = static_cast<std::ptrdiff_t>(first);
+        tile.last = static_cast<std::ptrdiff_t>(last);
+        auto above = grid.row(tile.first - 1);
+        auto below = grid.row(tile.last);
+        tile.above.assign(std::begin(above), std::end(above));
+        tile.below.assign(std::begin(below), std::end(below));
+        tile.previous.resize(grid.stride());
+        tile.accessible.resize(grid.stride());
+    }
+    return tiles;
+}
+
+/**
+ * One round over all tiles on the worker threads, returns how many rolls were removed.
+ */
+constexpr std::int64_t removeRound(BitGrid& grid, std::span<Tile> tiles)
+{
+    parallel::forEachIndex(  //
+        std::size(tiles),
+        [&](std::size_t t) { tiles[t].removed = removeInTile(grid, tiles[t]); });
+    return algorithm::sum(tiles | std::views::transform(&Tile::removed));
+}
+}  // namespace detail
+
+/**
+ * Removes all accessible rolls at once, returns how many were removed. Tiles of rows
+ * are updated in parallel, each with a buffer of two rows instead of one for the grid.
+ */
+constexpr std::int64_t solveStep(BitGrid& grid)
+{
+    auto tiles = detail::makeTiles(grid);
+    return detail::removeRound(grid, tiles);
+}
+
+constexpr auto solve1(BitGrid grid)
+{
+    return solveStep(grid);
+}
+
+static_assert(
+    []
+    {
+        using std::string_literals::operator""s;
+        std::vector input{
+            "..@@.@@@@."s,
+            "@@@.@.@.@@"s,
+            "@@@@@.@.@@"s,
+            "@.@@@@..@."s,
+            "@@.@@@@.@@"s,
+            ".@@@@@@@.@"s,
+            ".@.@.@.@@@"s,
+            "@.@@@.@@@@"s,
+            ".@@@@@@@@."s,
+            "@.@.@@@.@."s,
+        };
+        return solve1(input) == 13;
+    }());
+
+
+/**
+ * Removes accessible rolls round by round until none is left, returns how many.
+ */
+constexpr std::int64_t removeInRounds(BitGrid& grid)
+{
+    // the tiles and their buffers are reused by all rounds
+    auto tiles = detail::makeTiles(grid);
+    std::int64_t result = 0;
+    while (auto num = detail::removeRound(grid, tiles))
+    {
+        result += num;
+        for (auto& tile : tiles)
+        {
+            detail::refreshHalo(tile.above, grid.row(tile.first - 1));
+            detail::refreshHalo(tile.below, grid.row(tile.last));
+        }
+    }
+    return result;
+}
+
+/**
+ * Removes every roll that becomes accessible, like k-core peeling: a worklist holds the
+ * rolls to remove, removing one decrements the neighbour counts of the rolls around it
+ * and queues those that drop below 4. O(cells + removals) instead of a grid scan per
+ * round. A roll stays accessible once it is, so the order does not change what is
+ * removed; taking the latest first keeps the work close to where it was queued.
+ */
+constexpr std::int64_t removeByPeeling(BitGrid& grid)
+{
+    constexpr std::array<std::pair<std::ptrdiff_t, std::ptrdiff_t>, 8> directions{
+        {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}}};
+    auto height = static_cast<std::ptrdiff_t>(grid.height());
+    auto width = static_cast<std::ptrdiff_t>(grid.width());
+
+    // a roll's count is taken from the grid when it is first reached and decremented for
+    // every neighbour removed after that; queued rolls stay in the grid until processed
+    constexpr std::uint8_t unknown = 0xff;
+    constexpr std::uint8_t queued = 0xfe;
+    std::vector<std::uint8_t> counts(grid.height() * grid.width(), unknown);
+    auto count = [&](std::ptrdiff_t i, std::ptrdiff_t j) -> std::uint8_t&
+    {
+        return counts[static_cast<std::size_t>(i * width + j)];
+    };
+
+    // rolls accessible from the start are found 64 at a time
+    std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>> worklist;
+    std::vector<std::uint64_t> accessible(grid.stride());
+    for (std::ptrdiff_t i = 0; i < height; ++i)
+    {
+        accessibleRolls(grid.row(i - 1), grid.row(i), grid.row(i + 1), accessible);
+        for (std::size_t w = 0; w < std::size(accessible); ++w)
+        {
+            for (auto bits = accessible[w]; bits != 0; bits &= bits - 1)
+            {
+                auto j = static_cast<std::ptrdiff_t>(w * 64) + std::countr_zero(bits);
+                count(i, j) = queued;
+                worklist.emplace_back(i, j);
+            }
+        }
+    }
+
+    std::int64_t removed = 0;
+    while (not std::empty(worklist))
+    {
+        auto [i, j] = worklist.back();
+        worklist.pop_back();
+        ++removed;
+        grid.removeRoll(i, j);
+        for (auto [di, dj] : directions)
+        {
+            auto ni = i + di;
+            auto nj = j + dj;
+            if (not grid.roll(ni, nj) || count(ni, nj) == queued)
+                continue;
+
+            auto& neighbours = count(ni, nj);
+            if (neighbours == unknown)
+            {
+                neighbours = static_cast<std::uint8_t>(grid.block(ni, nj) - 1);
+            }
+            else
+                --neighbours;
+
+            if (neighbours < 4)
+            {
+                neighbours = queued;
+                worklist.emplace_back(ni, nj);
+            }
+        }
+    }
+    return removed;
+}
+
+/**
+ * removeInRounds on horizontal tiles updated by the worker threads. Tiles see each
+ * other only through their halo rows, exchanged between rounds. A tile that removed
+ * nothing and whose halos did not change would remove nothing again, so it is skipped;
+ * late rounds only touch the tiles where rolls are still falling.
+ */
+constexpr std::int64_t removeInTiles(BitGrid& grid)
+{
+    auto tiles = detail::makeTiles(grid);
+    auto count = std::size(tiles);
+    std::vector<std::size_t> active(count);
+    for (std::size_t t = 0; t < count; ++t)
+        active[t] = t;
+
+    std::int64_t result = 0;
+    while (not std::empty(active))
+    {
+        parallel::forEachIndex(  //
+            std::size(active),
+            [&](std::size_t k)
+            {
+                auto& tile = tiles[active[k]];
+                tile.removed = detail::removeInTile(grid, tile);
+            });
+
+        // halos can only change next to a tile that removed something
+        std::vector<std::size_t> next;
+        for (std::size_t t = 0; t < count; ++t)
+        {
+            auto& tile = tiles[t];
+            auto changed = false;
+            if (t > 0 && tiles[t - 1].removed > 0)
+                changed |= detail::refreshHalo(tile.above, grid.row(tile.first - 1));
+            if (t + 1 < count && tiles[t + 1].removed > 0)
+                changed |= detail::refreshHalo(tile.below, grid.row(tile.last));
+            if (tile.removed > 0 || changed)
+                next.push_back(t);
+        }
+        for (auto t : active)
+        {
+            result += tiles[t].removed;
+            tiles[t].removed = 0;
+        }
+        active = std::move(next);
+    }
+    return result;
+}
+
+namespace detail
+{
+// Peel when the first round removes less than 1 / peelShare of the rolls
+constexpr std::int64_t peelShare = 64;
+}  // namespace detail
+
+/**
+ * Rounds skip settled tiles but still pass over every active one per round, peeling is
+ * linear in the removals but jumps around the grid. A first round removing only a small
+ * share of the rolls hints at removals cascading slowly over many rounds (e.g. bands
+ * eaten from their ends), where peeling wins by far; otherwise rounds are faster.
+ * Removal order does not matter, so either engine continues after the first round.
+ */
+constexpr auto solve2(BitGrid grid)
+{
+    auto rolls = grid.rollCount();
+    auto removed = solveStep(grid);
+    if (removed * detail::peelShare < rolls)
+        return removed + removeByPeeling(grid);
+    return removed + removeInTiles(grid);
+}
+
+static_assert(
+    []
+    {
+        using std::string_literals::operator""s;
+        std::vector input{
+            "..@@.@@@@."s,
+            "@@@.@.@.@@"s,
+            "@@@@@.@.@@"s,
+            "@.@@@@..@."s,
+            "@@.@@@@.@@"s,
+            ".@@@@@@@.@"s,
+            ".@.@.@.@@@"s,
+            "@.@@@.@@@@"s,
+            ".@@@@@@@@."s,
+            "@.@.@@@.@."s,
+        };
+        return solve2(input) == 43;
+    }());
+static_assert(
+    []
+    {
+        BitGrid rounds{std::array{"@@@@@.", "@@@@@@", "@@@.@@", ".@@@@@", "@@@@@@"}};
+        auto peeled = rounds;
+        auto tiled = rounds;
+        auto removed = removeInRounds(rounds);
+        return removed == removeByPeeling(peeled) && removed == removeInTiles(tiled)
+               && rounds == peeled && rounds == tiled;
+    }());
+static_assert(
+    []
+    {
+        // three tiles
+        std::vector<std::string> rows(3 * detail::tileRows, std::string(70, '@'));
+        for (std::size_t i = 0; i < std::size(rows); ++i)
+        {
+            for (std::size_t j = 0; j < std::size(rows[i]); ++j)
+            {
+                if ((i * 7 + j * 3) % 11 == 0)
+                    rows[i][j] = '.';
+            }
+        }
+        BitGrid rounds{rows};
+        auto tiled = rounds;
+        return removeInRounds(rounds) == removeInTiles(tiled) && rounds == tiled;
+    }());
+
+static_assert(
+    []
+    {
+        // bands peeled from their ends take solve2's peeling path
+        std::string full(300, '@');
+        std::string empty(300, '.');
+        std::vector<std::string> rows{full, full, empty, full, full, empty};
+        BitGrid rounds{rows};
+        return solve2(rounds) == 4 * 300 && removeInRounds(rounds) == 4 * 300;
+    }());
+
+// The grid is modified while solving, so it is the only day that copies its input
+constexpr BitGrid readInput(std::string_view content)
+{
+    return BitGrid{input::tokens(content)};
+}
+
+}  // namespace aoc2025::day04
@@ -0,0 +1,27 @@
+#include "day04.h"
+
+#include "util/registry.h"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace aoc2025::day04
+{
+namespace
+{
+const registry::Registrar registrar{{
+    .name = "day04",
+    .day = 4,
+    .load =
+        [](std::string_view content)
+    {
+        auto input = std::make_shared<const BitGrid>(readInput(content));
+        return std::vector{
+            registry::makePart(1, [input] { return solve1(*input); }),
+            registry::makePart(2, [input] { return solve2(*input); }),
+        };
+    },
+}};
+}  // namespace
+}  // namespace aoc2025::day04
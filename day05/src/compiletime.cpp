@@ -0,0 +1,24 @@
+#include "day05.h"
+
+#include "util/embed.h"
+
+#include <fmt/format.h>
+
+#include <utility>
+
+namespace
+{
+using namespace aoc2025::day05;
+
+constexpr auto answers = []
+{
+    auto input = readInput(aoc2025::embed::input);
+    return std::pair{solve1(input.ranges, input.ids), solve2(input.ranges)};
+}();
+}  // namespace
+
+int main()
+{
+    fmt::println("day05.1: {}", answers.first);
+    fmt::println("day05.2: {}", answers.second);
+}
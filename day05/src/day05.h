@@ -0,0 +1,264 @@
+#pragma once
+
+#include "util/parse.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <ranges>
+
+namespace aoc2025::day05
+{
+using Id = std::int64_t;
+struct IdRange
+{
+    Id start;
+    Id end;
+};
+
+/**
+ * Ids covered by the ranges inserted so far, kept as disjoint merged ranges in a treap
+ * ordered by start. insert, contains and coveredCount take O(log n) amortized: every
+ * range an insert absorbs is removed once. Nodes live in one vector and are reused.
+ */
+class IntervalSet
+{
+public:
+    constexpr void insert(IdRange range)
+    {
+        assert(range.start <= range.end && "ranges are inclusive");
+        auto [below, rest] = split(root_, range.start, false);
+        auto [overlapping, above] = split(rest, range.end, true);  // no end + 1 overflow
+        if (overlapping != none)
+            range.end = std::max(range.end, nodes_[last(overlapping)].range.end);
+        release(overlapping);
+
+        // only the last range starting before this one can reach into it
+        if (below != none)
+        {
+            auto& previous = nodes_[last(below)].range;
+            if (previous.end >= range.start)
+            {
+                covered_ += std::max<Id>(range.end - previous.end, 0);
+                previous.end = std::max(previous.end, range.end);
+                root_ = merge(below, above);
+                return;
+            }
+        }
+        covered_ += range.end - range.start + 1;
+        ++size_;
+        root_ = merge(merge(below, allocate(range)), above);
+    }
+
+    constexpr bool contains(Id id) const
+    {
+        const IdRange* candidate = nullptr;  // the range with the last start <= id
+        for (auto node = root_; node != none;)
+        {
+            const auto& current = nodes_[static_cast<std::size_t>(node)];
+            if (current.range.start <= id)
+            {
+                candidate = &current.range;
+                node = current.right;
+            }
+            else
+                node = current.left;
+        }
+        return candidate != nullptr && id <= candidate->end;
+    }
+
+    constexpr Id coveredCount() const { return covered_; }
+
+    /**
+     * Number of disjoint ranges.
+     */
+    constexpr std::size_t size() const { return size_; }
+
+private:
+    static constexpr int none = -1;
+
+    struct Node
+    {
+        IdRange range;
+        std::uint64_t priority = 0;
+        int left = none;
+        int right = none;
+    };
+
+    constexpr Node& node(int index) { return nodes_[static_cast<std::size_t>(index)]; }
+
+    /**
+     * Splits a subtree into the ranges starting before key (or at it, if inclusive) and
+     * the others.
+     */
+    constexpr std::pair<int, int> split(int root, Id key, bool inclusive)
+    {
+        if (root == none)
+            return {none, none};
+        auto start = node(root).range.start;
+        if (start < key || (inclusive && start == key))
+        {
+            auto [left, right] = split(node(root).right, key, inclusive);
+            node(root).right = left;
+            return {root, right};
+        }
+        auto [left, right] = split(node(root).left, key, inclusive);
+        node(root).left = right;
+        return {left, root};
+    }
+
+    /**
+     * Joins two subtrees, every range of left starts before the ranges of right.
+     */
+    constexpr int merge(int left, int right)
+    {
+        if (left == none || right == none)
+            return left == none ? right : left;
+        if (node(left).priority > node(right).priority)
+        {
+            node(left).right = merge(node(left).right, right);
+            return left;
+        }
+        node(right).left = merge(left, node(right).left);
+        return right;
+    }
+
+    constexpr std::size_t last(int root)
+    {
+        while (node(root).right != none)
+            root = node(root).right;
+        return static_cast<std::size_t>(root);
+    }
+
+    constexpr int allocate(IdRange range)
+    {
+        // splitmix64 of a counter, any fixed sequence keeps the expected depth logarithmic
+        auto priority = (counter_ += 0x9e3779b97f4a7c15);
+        priority = (priority ^ (priority >> 30)) * 0xbf58476d1ce4e5b9;
+        priority = (priority ^ (priority >> 27)) * 0x94d049bb133111eb;
+        Node fresh{.range = range, .priority = priority ^ (priority >> 31)};
+
+        if (std::empty(free_))
+        {
+            nodes_.push_back(fresh);
+            return static_cast<int>(std::size(nodes_) - 1);
+        }
+        auto index = free_.back();
+        free_.pop_back();
+        node(index) = fresh;
+        return index;
+    }
+
+    /**
+     * Drops a subtree, the caller covers its ranges again.
+     */
+    constexpr void release(int root)
+    {
+        if (root == none)
+            return;
+        release(node(root).left);
+        release(node(root).right);
+        covered_ -= node(root).range.end - node(root).range.start + 1;
+        --size_;
+        free_.push_back(root);
+    }
+
+    std::vector<Node> nodes_;
+    std::vector<int> free_;
+    int root_ = none;
+    std::size_t size_ = 0;
+    Id covered_ = 0;
+    std::uint64_t counter_ = 0;
+};
+
+static_assert(
+    []
+    {
+        IntervalSet set;
+        set.insert({10, 14});
+        set.insert({3, 5});
+        if (not set.contains(4) || set.contains(6) || set.contains(15) || set.contains(2))
+            return false;
+        set.insert({6, 8});  // adjacent ranges stay apart
+        set.insert({12, 18});
+        set.insert({16, 20});
+        if (set.size() != 3 || set.coveredCount() != 17 || not set.contains(20))
+            return false;
+        set.insert({4, 11});
+        set.insert({1, 2});
+        return set.size() == 2 && set.coveredCount() == 20 && set.contains(11);
+    }());
+static_assert(
+    []
+    {
+        constexpr auto max = std::numeric_limits<Id>::max();
+        IntervalSet set;
+        set.insert({max - 1, max});
+        set.insert({max - 5, max});
+        return set.size() == 1 && set.coveredCount() == 6 && set.contains(max);
+    }());
+
+constexpr IntervalSet makeIntervalSet(std::span<const IdRange> ranges)
+{
+    IntervalSet set;
+    for (const auto& range : ranges)
+        set.insert(range);
+    return set;
+}
+
+constexpr int solve1(std::span<const IdRange> ranges, std::span<const Id> ids)
+{
+    return static_cast<int>(std::ranges::count_if(  //
+        ids,
+        [set = makeIntervalSet(ranges)](auto id) { return set.contains(id); }));
+}
+
+static_assert(
+    []
+    {
+        auto ids = std::to_array<Id>({1, 4, 7, 11, 15, 21});
+        return solve1(std::vector<IdRange>{{3, 5}, {10, 14}, {16, 20}, {12, 18}}, ids)
+               == 3;
+    }());
+
+
+constexpr auto solve2(std::span<const IdRange> ranges)
+{
+    return makeIntervalSet(ranges).coveredCount();
+}
+
+static_assert(
+    []
+    {
+        return solve2(std::vector<IdRange>{{3, 5}, {10, 14}, {16, 20}, {12, 18}}) == 14;
+    }());
+
+struct Input
+{
+    std::vector<IdRange> ranges;
+    std::vector<Id> ids;
+};
+
+/**
+ * Ranges and ids are separated by an empty line.
+ */
+constexpr Input readInput(std::string_view content)
+{
+    auto separator = std::min(content.find("\n\n"), std::size(content));
+    return {
+        .ranges = parse::parseIntegers<Id>(content.substr(0, separator))
+                  | std::views::chunk(2)
+                  | std::views::transform([](auto pair) { return IdRange{pair[0], pair[1]}; })
+                  | std::ranges::to<std::vector>(),
+        .ids = parse::parseIntegers<Id>(content.substr(separator)),
+    };
+}
+
+}  // namespace aoc2025::day05
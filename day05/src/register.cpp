@@ -0,0 +1,27 @@
+#include "day05.h"
+
+#include "util/registry.h"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace aoc2025::day05
+{
+namespace
+{
+const registry::Registrar registrar{{
+    .name = "day05",
+    .day = 5,
+    .load =
+        [](std::string_view content)
+    {
+        auto input = std::make_shared<const Input>(readInput(content));
+        return std::vector{
+            registry::makePart(1, [input] { return solve1(input->ranges, input->ids); }),
+            registry::makePart(2, [input] { return solve2(input->ranges); }),
+        };
+    },
+}};
+}  // namespace
+}  // namespace aoc2025::day05
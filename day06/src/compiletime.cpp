@@ -0,0 +1,25 @@
+#include "day06.h"
+
+#include "util/embed.h"
+
+#include <fmt/format.h>
+
+#include <utility>
+
+namespace
+{
+using namespace aoc2025::day06;
+
+constexpr auto answers = []
+{
+    auto lines = readInput(aoc2025::embed::input);
+    auto worksheet = parseWorksheet(lines);
+    return std::pair{solve1(worksheet.input, worksheet.instructions), processInput2(lines)};
+}();
+}  // namespace
+
+int main()
+{
+    fmt::println("day06.1: {}", answers.first);
+    fmt::println("day06.2: {}", answers.second);
+}
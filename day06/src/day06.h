@@ -0,0 +1,169 @@
+#pragma once
+
+#include "util/algorithm.h"
+#include "util/input.h"
+#include "util/parse.h"
+#include "util/views.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <ranges>
+#include <functional>
+
+namespace aoc2025::day06
+{
+enum class Instruction
+{
+    Add = '+',
+    Mul = '*',
+};
+constexpr std::vector<std::int64_t> findTotal(
+    const std::vector<std::vector<std::int64_t>>& input,
+    const std::vector<Instruction>& instructions)
+{
+    return std::ranges::fold_left(  //
+        input | std::views::drop(1),
+        input[0],
+        [&instructions](auto&& acc, const auto& next)
+        {
+            for (auto [instruction, a, b] : std::views::zip(instructions, acc, next))
+            {
+                switch (instruction)
+                {
+                case Instruction::Add:
+                    a += b;
+                    break;
+                case Instruction::Mul:
+                    a *= b;
+                    break;
+                }
+            }
+            return std::move(acc);
+        });
+}
+constexpr std::int64_t solve1(const std::vector<std::vector<std::int64_t>>& input,
+                              const std::vector<Instruction>& instructions)
+{
+    return algorithm::sum(findTotal(input, instructions));
+}
+
+static_assert(
+    []
+    {
+        auto result = solve1(  //
+            std::vector{std::vector<std::int64_t>{123, 328, 51, 64},
+                        std::vector<std::int64_t>{45, 64, 387, 23},
+                        std::vector<std::int64_t>{6, 98, 215, 314}},
+            std::vector{Instruction::Mul, Instruction::Add, Instruction::Mul, Instruction::Add});
+        return result == 4277556;
+    }());
+
+template <typename Lines = std::vector<std::string>>
+constexpr std::int64_t processInput2(const Lines& lines)
+{
+    // ugly, but surprisingly, still can be constexpr
+    namespace rv = std::views;
+    auto columns = std::ssize(lines[0]);
+    auto rows = std::ssize(lines);
+    auto notEmpty = rv::filter(std::bind_front(std::not_equal_to{}, ' '));
+    auto numbers =  // make a series of numbers from columns
+        rv::iota(0, columns)
+        | rv::transform(
+            [&](auto col)
+            {
+                auto val = std::ranges::fold_left(  //
+                    lines | rv::take(rows - 1)
+                        | rv::transform([&](const auto& line)
+                                        { return line[col]; })
+                        | notEmpty,
+                    0ll,
+                    [](auto acc, auto ch) { return acc * 10 + (ch - '0'); });
+                return val;
+            })
+        | std::ranges::to<std::vector>();
+    auto instructions =  // extract instructions
+        lines.back() | notEmpty
+        | rv::transform(
+            [](auto ch)
+            { return ch == '*' ? Instruction::Mul : Instruction::Add; })
+        | std::ranges::to<std::vector<Instruction>>();
+    // zeroes are now delimiters - group by zeroes and apply instruction
+    auto groupResults =  //
+        numbers | rv::split(0) | rv::enumerate
+        | rv::transform(
+            [&](auto chunked)
+            {
+                auto [index, chunk] = chunked;
+                return std::ranges::fold_left(  //
+                    chunk,
+                    instructions[index] == Instruction::Mul ? 1ll : 0ll,
+                    [&](auto acc, auto val)
+                    {
+                        switch (instructions[index])
+                        {
+                        case Instruction::Add:
+                            return acc + val;
+                        case Instruction::Mul:
+                            return acc * val;
+                        }
+                        std::unreachable();
+                    });
+            });
+    return std::ranges::fold_left(groupResults, 0ll, std::plus<>{});
+}
+
+static_assert(
+    []
+    {
+        return processInput2({
+                   //
+                   "123 328  51 64 ",
+                   " 45 64  387 23 ",
+                   "  6 98  215 314",
+                   "*   +   *   +  "  //
+               })
+               == 3263827;
+    }());
+
+// Lines are views into the input content, which has to outlive them
+constexpr std::vector<std::string_view> readInput(std::string_view content)
+{
+    return input::lines(content) | std::ranges::to<std::vector>();
+}
+
+struct Worksheet
+{
+    std::vector<std::vector<std::int64_t>> input;
+    std::vector<Instruction> instructions;
+};
+
+constexpr Worksheet parseWorksheet(std::span<const std::string_view> lines)
+{
+    Worksheet worksheet;
+    for (const auto& line : lines)
+    {
+        if (line[0] == '*' || line[0] == '+')
+        {
+            worksheet.instructions =
+                std::views::split(line, ' ') | aoc2025::views::notEmpty
+                | std::views::transform(
+                    [](auto part)
+                    {
+                        return std::string_view{std::begin(part), std::end(part)} == "*"
+                                   ? Instruction::Mul
+                                   : Instruction::Add;
+                    })
+                | std::ranges::to<std::vector<Instruction>>();
+        }
+        else
+        {
+            worksheet.input.push_back(parse::parseIntegers<std::int64_t>(line));
+        }
+    }
+    return worksheet;
+}
+}  // namespace aoc2025::day06
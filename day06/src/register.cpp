@@ -0,0 +1,29 @@
+#include "day06.h"
+
+#include "util/registry.h"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace aoc2025::day06
+{
+namespace
+{
+const registry::Registrar registrar{{
+    .name = "day06",
+    .day = 6,
+    .load =
+        [](std::string_view content)
+    {
+        auto lines = std::make_shared<const std::vector<std::string_view>>(readInput(content));
+        auto worksheet = std::make_shared<const Worksheet>(parseWorksheet(*lines));
+        return std::vector{
+            registry::makePart(
+                1, [worksheet] { return solve1(worksheet->input, worksheet->instructions); }),
+            registry::makePart(2, [lines] { return processInput2(*lines); }),
+        };
+    },
+}};
+}  // namespace
+}  // namespace aoc2025::day06
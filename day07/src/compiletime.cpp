@@ -0,0 +1,23 @@
+#include "day07.h"
+
+#include "util/embed.h"
+
+#include <fmt/format.h>
+
+#include <utility>
+
+namespace
+{
+using namespace aoc2025::day07;
+
+constexpr auto answers = []
+{
+    return solveImpl(readInput(aoc2025::embed::input));
+}();
+}  // namespace
+
+int main()
+{
+    fmt::println("day07.1: {}", answers.first);
+    fmt::println("day07.2: {}", answers.second);
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "util/algorithm.h"
+#include "util/input.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <ranges>
+#include <utility>
+
+namespace aoc2025::day07
+{
+
+
+constexpr std::pair<std::int64_t, std::int64_t> solveImpl(
+    const std::ranges::sized_range auto& input)
+{
+    struct Accumulator
+    {
+        std::vector<std::int64_t> line;
+        std::int64_t splitCount;
+    };
+    auto workRow = [&]
+    {
+        return std::vector(std::size(input), 0ll);
+    };
+    auto result = std::ranges::fold_left(  //
+        input,
+        Accumulator{workRow(), 0ll},
+        [next = workRow()](auto&& acc, const auto& line) mutable
+        {
+            std::ranges::fill(next, 0ll);
+            for (auto [i, ch] : line | std::views::enumerate)
+            {
+                switch (ch)
+                {
+                case 'S':
+                    next[i] = 1;
+                    break;
+                case '.':
+                    next[i] += acc.line[i];
+                    break;
+                case '^':
+                    acc.splitCount += acc.line[i] > 0;
+                    assert(i > 0 && i + 1 < std::ssize(acc.line));
+                    next[i - 1] += acc.line[i];
+                    next[i + 1] += acc.line[i];
+                    next[i] = 0;
+                    break;
+                }
+            }
+            std::swap(acc.line, next);
+            return std::move(acc);
+        });
+    return {result.splitCount, algorithm::sum(result.line)};
+}
+
+static_assert(
+    []
+    {
+        std::vector<std::string> input{
+            ".......S.......",
+            "...............",
+            ".......^.......",
+            "...............",
+            "......^.^......",
+            "...............",
+            ".....^.^.^.....",
+            "...............",
+            "....^.^...^....",
+            "...............",
+            "...^.^...^.^...",
+            "...............",
+            "..^...^.....^..",
+            "...............",
+            ".^.^.^.^.^...^.",
+            "...............",
+        };
+        return solveImpl(input) == std::pair{21ll, 40ll};
+    }());
+
+// Lines are views into the input content, which has to outlive them
+constexpr std::vector<std::string_view> readInput(std::string_view content)
+{
+    return input::lines(content) | std::ranges::to<std::vector>();
+}
+}  // namespace aoc2025::day07
@@ -0,0 +1,27 @@
+#include "day07.h"
+
+#include "util/registry.h"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace aoc2025::day07
+{
+namespace
+{
+const registry::Registrar registrar{{
+    .name = "day07",
+    .day = 7,
+    .load =
+        [](std::string_view content)
+    {
+        auto input = std::make_shared<const std::vector<std::string_view>>(readInput(content));
+        return std::vector{
+            registry::makePart(1, [input] { return solveImpl(*input).first; }),
+            registry::makePart(2, [input] { return solveImpl(*input).second; }),
+        };
+    },
+}};
+}  // namespace
+}  // namespace aoc2025::day07
@@ -0,0 +1,24 @@
+#include "day08.h"
+
+#include "util/embed.h"
+
+#include <fmt/format.h>
+
+#include <utility>
+
+namespace
+{
+using namespace aoc2025::day08;
+
+constexpr auto answers = []
+{
+    auto input = readInput(aoc2025::embed::input).value();
+    return std::pair{solve1(input, 1000), solve2(input)};
+}();
+}  // namespace
+
+int main()
+{
+    fmt::println("day08.1: {}", answers.first);
+    fmt::println("day08.2: {}", answers.second);
+}
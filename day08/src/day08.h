@@ -0,0 +1,146 @@
+#pragma once
+
+#include "util/geometry3d.h"
+#include "util/input.h"
+#include "util/parallel.h"
+#include "util/parse.h"
+#include "util/views.h"
+#include "util/functors.h"
+#include "util/trace.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string_view>
+#include <vector>
+#include <ranges>
+#include <optional>
+
+namespace aoc2025::day08
+{
+constexpr auto enableProfiling = false;
+constexpr auto profiler = diagnostic::makeProfiler<enableProfiling>();
+
+constexpr auto solveTree(std::span<const geometry3d::Point> points,
+                         std::optional<std::int64_t> iterations)
+{
+    namespace rv = std::ranges::views;
+    namespace rng = std::ranges;
+
+    struct Edge
+    {
+        std::int64_t id1;
+        std::int64_t id2;
+        std::int64_t distance;
+    };
+
+    auto edges = [&]
+    {
+        auto span = profiler.span("day08.edges");
+        auto n = std::ssize(points);
+        // every pair goes to its row-major slot, so the order does not depend on threads
+        std::vector<Edge> result(views::pairsBefore(n, n));
+        geometry3d::PointCloud3d cloud{points};
+        auto chunks = views::partitionUpperTriangle(n, parallel::threadCount());
+        parallel::forEachIndex(  //
+            std::size(chunks),
+            [&](std::size_t chunk)
+            {
+                std::array<std::int64_t, views::defaultPairBlockSize> distances{};
+                auto [rowBegin, rowEnd] = chunks[chunk];
+                for (const auto& block : views::upperTriangleBlocks(rowBegin, rowEnd, n))
+                {
+                    views::forEachRow(
+                        block,
+                        [&](std::int64_t i, std::int64_t jBegin, std::int64_t jEnd)
+                        {
+                            auto row = std::span{distances}.first(
+                                static_cast<std::size_t>(jEnd - jBegin));
+                            geometry3d::euclideanDistanceSquare(
+                                points[i], cloud, static_cast<std::size_t>(jBegin), row);
+                            auto* edge = std::data(result) + views::pairIndex(n, i, jBegin);
+                            for (auto j = jBegin; j < jEnd; ++j)
+                                *edge++ = {.id1 = i, .id2 = j, .distance = row[j - jBegin]};
+                        });
+                }
+            });
+        return result;
+    }();
+    profiler.counter("day08.edges", std::ssize(edges));
+    {
+        auto span = profiler.span("day08.sort");
+        rng::sort(edges, std::less{}, &Edge::distance);
+    }
+
+    auto unionSpan = profiler.span("day08.union");
+    auto vertexColor = rv::iota(0ll, std::ssize(points)) | rng::to<std::vector>();
+    std::vector<std::pair<std::int64_t, std::int64_t>> connections;
+    auto notDone = [&](const auto& val)
+    {
+        const auto& [itNum, _] = val;
+        return iterations.transform(std::bind_front(std::less{}, itNum))
+            .value_or(std::ssize(connections) < std::ssize(points) - 1);
+    };
+    for (const auto& [_, edge] : edges | rv::enumerate | rv::take_while(notDone))
+    {
+        auto newColor = vertexColor[edge.id1];
+        auto oldColor = vertexColor[edge.id2];
+        if (newColor == oldColor)
+            continue;
+
+        connections.emplace_back(edge.id1, edge.id2);
+        // we already O(N^2), because of computing distances, so don't care about another loop
+        rng::replace(vertexColor, oldColor, newColor);
+    }
+    return std::pair{std::move(vertexColor), std::move(connections)};
+}
+
+constexpr auto solve1(std::span<const geometry3d::Point> points, std::int64_t iterations)
+{
+    namespace rv = std::ranges::views;
+    namespace rng = std::ranges;
+
+    auto [vertexColor, _] = solveTree(points, iterations);
+    rng::sort(vertexColor);
+    auto groups = vertexColor | rv::chunk_by(rng::equal_to{})
+                  | rv::transform(functors::ssize) | rng::to<std::vector>();
+    rng::sort(groups, std::greater{});
+    return rng::fold_left(groups | rv::take(3), 1ll, std::multiplies{});
+}
+
+constexpr auto testSet = std::to_array<geometry3d::Point>({
+    {162, 817, 812}, {57, 618, 57},   {906, 360, 560}, {592, 479, 940},
+    {352, 342, 300}, {466, 668, 158}, {542, 29, 236},  {431, 825, 988},
+    {739, 650, 466}, {52, 470, 668},  {216, 146, 977}, {819, 987, 18},
+    {117, 168, 530}, {805, 96, 715},  {346, 949, 466}, {970, 615, 88},
+    {941, 993, 340}, {862, 61, 35},   {984, 92, 344},  {425, 690, 689},
+});
+
+static_assert(solve1(testSet, 10) == 40);
+
+constexpr auto solve2(std::span<const geometry3d::Point> points)
+{
+    auto [_, connections] = solveTree(points, std::nullopt);
+    auto [i, j] = connections.back();
+    return points[i].x * points[j].x;
+}
+
+static_assert(solve2(testSet) == 25272);
+
+constexpr std::optional<std::vector<geometry3d::Point>> readInput(std::string_view content)
+{
+    std::vector<geometry3d::Point> points;
+    for (auto line : input::lines(content))
+    {
+        std::array<std::int64_t, 3> coordinates{};
+        if (parse::parseIntegers<std::int64_t>(line, coordinates) != std::size(coordinates))
+            return std::nullopt;
+        auto [x, y, z] = coordinates;
+        points.emplace_back(x, y, z);
+    }
+    return points;
+}
+
+}  // namespace aoc2025::day08
@@ -0,0 +1,24 @@
+#include "day09.h"
+
+#include "util/embed.h"
+
+#include <fmt/format.h>
+
+#include <utility>
+
+namespace
+{
+using namespace aoc2025::day09;
+
+constexpr auto answers = []
+{
+    auto input = readInput(aoc2025::embed::input).value();
+    return std::pair{solve1(input), solve2(input)};
+}();
+}  // namespace
+
+int main()
+{
+    fmt::println("day09.1: {}", answers.first);
+    fmt::println("day09.2: {}", answers.second);
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "util/geometry2d.h"
+#include "util/input.h"
+#include "util/parallel.h"
+#include "util/parse.h"
+#include "util/views.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <vector>
+#include <tuple>
+
+namespace aoc2025::day09
+{
+
+/**
+ * Max over all pairs i < j < n (0 if there are none): rowMax(i, jBegin, jEnd, best)
+ * returns the max of best and the values of the pairs (i, j), j in [jBegin, jEnd).
+ * Rows are visited blockwise and split between threads.
+ */
+constexpr std::int64_t maxOverPairs(std::int64_t n, auto rowMax)
+{
+    auto chunks = views::partitionUpperTriangle(n, parallel::threadCount());
+    std::vector<std::int64_t> best(std::size(chunks));
+    parallel::forEachIndex(  //
+        std::size(chunks),
+        [&](std::size_t chunk)
+        {
+            std::int64_t result = 0;
+            auto [rowBegin, rowEnd] = chunks[chunk];
+            for (const auto& block : views::upperTriangleBlocks(rowBegin, rowEnd, n))
+            {
+                views::forEachRow(block,
+                                  [&](std::int64_t i, std::int64_t jBegin, std::int64_t jEnd)
+                                  { result = rowMax(i, jBegin, jEnd, result); });
+            }
+            best[chunk] = result;
+        });
+    return std::ranges::max(best);
+}
+
+/**
+ * Calls function(j, area) for the areas between points[i] and points [jBegin, jEnd),
+ * computed in batches of up to one block.
+ */
+constexpr void forEachArea(const geometry2d::PointCloud2d& cloud,
+                           std::int64_t i,
+                           std::int64_t jBegin,
+                           std::int64_t jEnd,
+                           auto function)
+{
+    std::array<std::int64_t, views::defaultPairBlockSize> areas{};
+    for (auto first = jBegin; first < jEnd; first += std::ssize(areas))
+    {
+        auto batch = std::span{areas}.first(
+            static_cast<std::size_t>(std::min(jEnd - first, std::ssize(areas))));
+        geometry2d::area(cloud[static_cast<std::size_t>(i)],
+                         cloud,
+                         static_cast<std::size_t>(first),
+                         batch);
+        for (auto k = 0uz; k < std::size(batch); ++k)
+            function(first + static_cast<std::int64_t>(k), batch[k]);
+    }
+}
+
+constexpr auto solve1(std::span<const geometry2d::Point> points)
+{
+    geometry2d::PointCloud2d cloud{points};
+    return maxOverPairs(std::ssize(points),
+                        [&](std::int64_t i, std::int64_t jBegin, std::int64_t jEnd, auto best)
+                        {
+                            forEachArea(cloud,
+                                        i,
+                                        jBegin,
+                                        jEnd,
+                                        [&](std::int64_t, std::int64_t area)
+                                        { best = std::max(best, area); });
+                            return best;
+                        });
+}
+
+constexpr auto testSet = std::to_array<geometry2d::Point>({
+    {7, 1},
+    {11, 1},
+    {11, 7},
+    {9, 7},
+    {9, 5},
+    {2, 5},
+    {2, 3},
+    {7, 3},
+});
+static_assert(solve1(testSet) == 50);
+
+constexpr auto solve2(std::span<const geometry2d::Point> points)
+{
+    namespace rv = std::ranges::views;
+    namespace rng = std::ranges;
+
+    using Box = geometry2d::Box;
+    auto boxFromIndices = [&points](auto pair)
+    {
+        auto [i, j] = pair;
+        return geometry2d::orderPoints(points[i], points[j]);
+    };
+
+    // Build edge boxes -- to skip some good cases
+    auto edges = rv::concat(points, rv::single(points[0])) | rv::adjacent<2>
+                 | rv::transform(
+                     [&](auto pair)
+                     {
+                         auto [p1, p2] = pair;
+                         return orderPoints(p1, p2);
+                     })
+                 | rng::to<std::vector>();
+
+    // Sort edges by their low.x so we can limit checks by x-range
+    rng::sort(edges, {}, [](const auto& edge) { return edge.lo.x; });
+
+    auto isCandidate = [&](const Box& box)
+    {
+        auto earlyExit =
+            rv::take_while([&](const auto& edge) { return edge.lo.x < box.hi.x; });
+        // only check edges with lo.x < box.hi.x
+        return rng::none_of(  //
+            edges | earlyExit,
+            [&](const auto& edge)
+            {
+                return  // check if edge intersects rectangle
+                    box.lo.x < edge.hi.x && box.lo.y < edge.hi.y && box.hi.x > edge.lo.x
+                    && box.hi.y > edge.lo.y;
+            });
+    };
+
+    // areas are positive, so 0 stands for no candidate; the cheap area rejects most
+    // pairs before the edge scan
+    geometry2d::PointCloud2d cloud{points};
+    return maxOverPairs(std::ssize(points),
+                        [&](std::int64_t i, std::int64_t jBegin, std::int64_t jEnd, auto best)
+                        {
+                            forEachArea(cloud,
+                                        i,
+                                        jBegin,
+                                        jEnd,
+                                        [&](std::int64_t j, std::int64_t area)
+                                        {
+                                            if (area > best
+                                                && isCandidate(boxFromIndices(std::pair{i, j})))
+                                                best = area;
+                                        });
+                            return best;
+                        });
+}
+
+static_assert(solve2(testSet) == 24);
+
+constexpr std::optional<std::vector<geometry2d::Point>> readInput(std::string_view content)
+{
+    std::vector<geometry2d::Point> points;
+    for (auto line : input::lines(content))
+    {
+        std::array<std::int64_t, 2> coordinates{};
+        if (parse::parseIntegers<std::int64_t>(line, coordinates) != std::size(coordinates))
+            return std::nullopt;
+        points.emplace_back(coordinates[0], coordinates[1]);
+    }
+    return points;
+}
+
+}  // namespace aoc2025::day09
@@ -0,0 +1,32 @@
+#include "day09.h"
+
+#include "util/registry.h"
+
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace aoc2025::day09
+{
+namespace
+{
+const registry::Registrar registrar{{
+    .name = "day09",
+    .day = 9,
+    .load =
+        [](std::string_view content)
+    {
+        auto points = readInput(content);
+        if (not points)
+            return std::vector<registry::Part>{};
+
+        auto input = std::make_shared<const std::vector<geometry2d::Point>>(std::move(*points));
+        return std::vector{
+            registry::makePart(1, [input] { return solve1(*input); }),
+            registry::makePart(2, [input] { return solve2(*input); }),
+        };
+    },
+}};
+}  // namespace
+}  // namespace aoc2025::day09
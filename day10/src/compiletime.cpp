@@ -0,0 +1,26 @@
+#include "part1.h"
+#include "part2.h"
+
+#include "util/embed.h"
+
+#include <fmt/format.h>
+
+#include <utility>
+
+namespace
+{
+using namespace aoc2025::day10;
+
+// each part has its own parser
+constexpr auto answers = []
+{
+    return std::pair{part1::solve1(part1::readInput(aoc2025::embed::input)),
+                     solve2(readInput(aoc2025::embed::input))};
+}();
+}  // namespace
+
+int main()
+{
+    fmt::println("day10.1: {}", answers.first);
+    fmt::println("day10.2: {}", answers.second);
+}
@@ -1,127 +1,15 @@
-#include "util/stopwatch.h"
-
+#include "part1.h"
 
-#include <ctre.hpp>
+#include "util/input.h"
+#include "util/stopwatch.h"
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 #include <fmt/chrono.h>
 
-#include <algorithm>
-#include <bitset>
-#include <cstdint>
-#include <functional>
-#include <fstream>
-#include <ranges>
-#include <span>
-#include <string>
-#include <vector>
-
-namespace aoc2025::day10
-{
-constexpr auto maxSize = 16;
-using Container = std::bitset<maxSize>;
-struct MachineConfiguration
-{
-    Container targetState;
-    std::vector<Container> switchers;
-};
-
-namespace rv = std::views;
-namespace rng = std::ranges;
-
-
-constexpr auto solve1(const MachineConfiguration& input)
-{
-    const auto numberOfOptions = (1 << std::size(input.switchers)) - 1;
-    return rv::iota(0, numberOfOptions)
-           | rv::filter(
-               [&](Container candidate)
-               {
-                   return rng::fold_left(  //
-                              input.switchers | rv::enumerate
-                                  | rv::transform(
-                                      [&](auto val)
-                                      {
-                                          auto [i, switcher] = val;
-                                          return candidate[i] ? switcher
-                                                              : Container{};
-                                      }),
-                              Container{},
-                              std::bit_xor{})
-                          == input.targetState;
-               });
-}
-
-constexpr auto solve1(std::span<const MachineConfiguration> input)
-{
-    return rng::fold_left(  //
-        input
-            | rv::transform(
-                [](const auto& config)
-                {
-                    return rng::min(
-                        solve1(config)
-                        | rv::transform([](Container c) { return c.count(); }));
-                }),
-        0,
-        std::plus{});
-}
-
-constexpr auto deserializeState(std::string_view str)
-{
-    Container result;
-    for (auto [i, ch] : str | rv::enumerate)
-        result.set(i, ch == '#');
-    return result;
-}
-static_assert(deserializeState(std::string_view{"#..##.."})
-              == Container{0b0011001});  // 0b1001100
-
-
-constexpr auto deserializeSwitcher(std::ranges::range auto config)
-{
-    Container result;
-    for (const auto num : config)
-        result.set(num);
-    return result;
-}
-static_assert(deserializeSwitcher(std::to_array<std::int8_t>({0, 1, 2, 4, 5, 7}))
-              == Container{0b10110111});
-
-constexpr MachineConfiguration deserializeConfig(std::string_view target,
-                                                 std::span<const Container> switchers)
-{
-    return {
-        .targetState = deserializeState(target),
-        .switchers{std::begin(switchers), std::end(switchers)},
-    };
-}
-// [.##.] (3) (1,3) (2) (2,3) (0,2) (0,1) {3,5,4,7}
-// [...#.] (0,2,3,4) (2,3) (0,4) (0,1,2) (1,2,3,4) {7,5,12,7,2}
-// [.###.#] (0,1,2,3,4) (0,3,4) (0,1,2,4,5) (1,2) {10,11,11,5,10,5}
-//
-static_assert(
-    []
-    {
-        auto testSet = std::to_array(  //
-            {deserializeConfig(        //
-                 ".##.",
-                 std::to_array<Container>({0b1000, 0b1010, 0b0100, 0b1100, 0b0101, 0b0011})),
-             deserializeConfig(  //
-                 "...#.",
-                 std::to_array<Container>({0b1101, 0b1100, 0b1001, 0b0111, 0b11110})),
-             deserializeConfig(  //
-                 ".###.#",
-                 std::to_array<Container>({0x011111, 0b011001, 0b110111, 0b000110}))});
-        return solve1(testSet) == 7;
-    }());
-
-}  // namespace aoc2025::day10
-
 int main()
 {
-    using namespace aoc2025::day10;
+    using namespace aoc2025::day10::part1;
     auto testSet = std::to_array(  //
         {deserializeConfig(        //
              ".##.",
@@ -135,33 +23,15 @@ int main()
     fmt::println("day10.test1: {}", solve1(testSet));
 
 
-    std::ifstream file("./input.txt");
+    auto file = aoc2025::input::InputFile::open("./input.txt");
     if (not file)
     {
         fmt::println("Could not open input.txt");
         return 1;
     }
 
-    std::vector<MachineConfiguration> configurations;
-    for (std::string line; std::getline(file, line);)
-    {
-        auto [_1, mask, buttons, _2] =
-            ctre::match<"\\[([\\.#]+)\\] (\\(.*\\)) \\{(.*)\\}">(line);
-        auto switchers =
-            ctre::search_all<R"(\([0-9,]+\))">(buttons.to_view())
-            | rv::transform(
-                [](auto match)
-                {
-                    return deserializeSwitcher(
-                        ctre::search_all<R"(\d+)">(match.to_view())
-                        | rv::transform([](auto numMatch)
-                                        { return numMatch.to_number(); }));
-                })
-            | rng::to<std::vector>();
-
-        configurations.push_back(deserializeConfig(mask.to_view(), switchers));
-    }
+    auto configurations = readInput(file->content());
     aoc2025::time::Stopwatch<> stopwatch;
     fmt::println("day10.solution1: {}", solve1(configurations));
     fmt::println("Time elapsed: {}", stopwatch.elapsed());  // 4ms
-}
\ No newline at end of file
+}
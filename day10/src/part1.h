@@ -0,0 +1,140 @@
+#pragma once
+
+#include "util/input.h"
+#include "util/parse.h"
+#include "util/smallvector.h"
+
+#include <ctre.hpp>
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// Nested to keep both parts of the day linkable into a single binary
+namespace aoc2025::day10::part1
+{
+// One bit per light; switcher subsets are enumerated as integer masks, so 64 bits
+// cover every configuration that can be brute forced.
+using Container = std::bitset<64>;
+using Switchers = containers::SmallVector<Container, 16>;
+struct MachineConfiguration
+{
+    Container targetState;
+    Switchers switchers;
+};
+
+namespace rv = std::views;
+namespace rng = std::ranges;
+
+
+constexpr auto solve1(const MachineConfiguration& input)
+{
+    const auto numberOfOptions = (std::uint64_t{1} << std::size(input.switchers)) - 1;
+    return rv::iota(std::uint64_t{0}, numberOfOptions)
+           | rv::filter(
+               [&](Container candidate)
+               {
+                   return rng::fold_left(  //
+                              input.switchers | rv::enumerate
+                                  | rv::transform(
+                                      [&](auto val)
+                                      {
+                                          auto [i, switcher] = val;
+                                          return candidate[i] ? switcher
+                                                              : Container{};
+                                      }),
+                              Container{},
+                              std::bit_xor{})
+                          == input.targetState;
+               });
+}
+
+constexpr auto solve1(std::span<const MachineConfiguration> input)
+{
+    return rng::fold_left(  //
+        input
+            | rv::transform(
+                [](const auto& config)
+                {
+                    return rng::min(
+                        solve1(config)
+                        | rv::transform([](Container c) { return c.count(); }));
+                }),
+        0,
+        std::plus{});
+}
+
+constexpr auto deserializeState(std::string_view str)
+{
+    Container result;
+    for (auto [i, ch] : str | rv::enumerate)
+        result.set(i, ch == '#');
+    return result;
+}
+static_assert(deserializeState(std::string_view{"#..##.."})
+              == Container{0b0011001});  // 0b1001100
+
+
+constexpr auto deserializeSwitcher(std::ranges::range auto config)
+{
+    Container result;
+    for (const auto num : config)
+        result.set(num);
+    return result;
+}
+static_assert(deserializeSwitcher(std::to_array<std::int8_t>({0, 1, 2, 4, 5, 7}))
+              == Container{0b10110111});
+
+constexpr MachineConfiguration deserializeConfig(std::string_view target,
+                                                 std::span<const Container> switchers)
+{
+    return {
+        .targetState = deserializeState(target),
+        .switchers = Switchers(std::begin(switchers), std::end(switchers)),
+    };
+}
+// [.##.] (3) (1,3) (2) (2,3) (0,2) (0,1) {3,5,4,7}
+// [...#.] (0,2,3,4) (2,3) (0,4) (0,1,2) (1,2,3,4) {7,5,12,7,2}
+// [.###.#] (0,1,2,3,4) (0,3,4) (0,1,2,4,5) (1,2) {10,11,11,5,10,5}
+//
+static_assert(
+    []
+    {
+        auto testSet = std::to_array(  //
+            {deserializeConfig(        //
+                 ".##.",
+                 std::to_array<Container>({0b1000, 0b1010, 0b0100, 0b1100, 0b0101, 0b0011})),
+             deserializeConfig(  //
+                 "...#.",
+                 std::to_array<Container>({0b1101, 0b1100, 0b1001, 0b0111, 0b11110})),
+             deserializeConfig(  //
+                 ".###.#",
+                 std::to_array<Container>({0x011111, 0b011001, 0b110111, 0b000110}))});
+        return solve1(testSet) == 7;
+    }());
+
+constexpr std::vector<MachineConfiguration> readInput(std::string_view content)
+{
+    std::vector<MachineConfiguration> configurations;
+    for (auto line : input::lines(content))
+    {
+        auto [_1, mask, buttons, _2] =
+            ctre::match<"\\[([\\.#]+)\\] (\\(.*\\)) \\{(.*)\\}">(line);
+        auto switchers =
+            ctre::search_all<R"(\([0-9,]+\))">(buttons.to_view())
+            | rv::transform(
+                [](auto match)
+                { return deserializeSwitcher(parse::parseIntegers<int>(match.to_view())); })
+            | rng::to<Switchers>();
+
+        configurations.push_back(deserializeConfig(mask.to_view(), switchers));
+    }
+    return configurations;
+}
+
+}  // namespace aoc2025::day10::part1
@@ -0,0 +1,41 @@
+#include "part1.h"
+#include "part2.h"
+
+#include "util/registry.h"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace aoc2025::day10
+{
+namespace
+{
+const registry::Registrar registrar1{{
+    .name = "day10-1",
+    .day = 10,
+    .load =
+        [](std::string_view content)
+    {
+        auto input = std::make_shared<const std::vector<part1::MachineConfiguration>>(
+            part1::readInput(content));
+        return std::vector{
+            registry::makePart(1, [input] { return part1::solve1(*input); }),
+        };
+    },
+}};
+
+const registry::Registrar registrar2{{
+    .name = "day10-2",
+    .day = 10,
+    .load =
+        [](std::string_view content)
+    {
+        auto input = std::make_shared<const std::vector<MachineConfiguration>>(readInput(content));
+        return std::vector{
+            registry::makePart(2, [input] { return solve2(*input); }),
+        };
+    },
+}};
+}  // namespace
+}  // namespace aoc2025::day10
@@ -0,0 +1,28 @@
+#include "day11.h"
+
+#include "util/registry.h"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace aoc2025::day11
+{
+namespace
+{
+const registry::Registrar registrar{{
+    .name = "day11",
+    .day = 11,
+    .load =
+        [](std::string_view content)
+    {
+        auto input = std::make_shared<const Connections>(readInput(content));
+        return std::vector{
+            registry::makePart(1, [input] { return solve1(*input, "you", "out"); }),
+            registry::makePart(
+                2, [input] { return solve2(*input, "svr", "out", {"fft", "dac"}); }),
+        };
+    },
+}};
+}  // namespace
+}  // namespace aoc2025::day11
@@ -0,0 +1,17 @@
+#include "day12.h"
+
+#include "util/embed.h"
+
+#include <fmt/format.h>
+
+namespace
+{
+using namespace aoc2025::day12;
+
+constexpr auto answer = solve1(readInput(aoc2025::embed::input));
+}  // namespace
+
+int main()
+{
+    fmt::println("day12.1: {}", answer);
+}
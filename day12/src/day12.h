@@ -0,0 +1,144 @@
+#pragma once
+
+#include "util/algorithm.h"
+#include "util/input.h"
+#include "util/parallel.h"
+#include "util/parse.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <ranges>
+
+namespace aoc2025::day12
+{
+constexpr std::size_t numberOfShapes = 6;
+
+struct Shape
+{
+    std::int64_t height = 0;
+    std::int64_t width = 0;
+    std::int64_t area = 0;
+    std::vector<std::string> data;
+};
+
+struct Requirements
+{
+    std::int64_t width = 0;
+    std::int64_t height = 0;
+    std::vector<std::int64_t> shapes;
+};
+
+struct Input
+{
+    std::vector<Shape> shapes;
+    std::vector<Requirements> requirements;
+};
+
+struct Stats
+{
+    std::int64_t availableArea = 0;
+    std::int64_t requiredSquareArea = 0;
+    std::int64_t requiredArea = 0;
+    double squareAreaRatio = 0.0;
+    double areaRatio = 0.0;
+};
+
+
+constexpr auto plus = []<typename T, typename U>(const std::pair<T, U>& l,
+                                                 const std::pair<T, U>& r)
+    -> std::pair<decltype(l.first + r.first), decltype(l.second + r.second)>
+{
+    return {l.first + r.first, l.second + r.second};
+};
+
+constexpr Stats computeStats(const Input& input, const Requirements& req)
+{
+    namespace rv = std::ranges::views;
+    namespace rng = std::ranges;
+    auto [requiredSquareAre, requiredArea] = rng::fold_left(  //
+        req.shapes | rv::enumerate
+            | rv::transform(
+                [&](auto val)
+                {
+                    auto [shapeNum, count] = val;
+                    const auto& shape = input.shapes[shapeNum];
+                    return std::pair{shape.width * shape.height * count, shape.area * count};
+                }),
+        std::pair<std::int64_t, std::int64_t>{0, 0},
+        plus);
+    return Stats{
+        .availableArea = req.width * req.height,
+        .requiredSquareArea = requiredSquareAre,
+        .requiredArea = requiredArea,
+        .squareAreaRatio = static_cast<double>(requiredSquareAre) / (req.width * req.height),
+        .areaRatio = static_cast<double>(requiredArea) / (req.width * req.height),
+    };
+}
+
+constexpr std::vector<Stats> computeStats(const Input& input)
+{
+    std::vector<Stats> result(std::size(input.requirements));
+    parallel::parallelFor(std::views::iota(std::size_t{0}, std::size(result)),
+                          [&](std::size_t i)
+                          { result[i] = computeStats(input, input.requirements[i]); });
+    return result;
+}
+
+/**
+ * Apparently there is no general case solution.
+ * However, looking at the output and ratio between needed are (copmuted by
+ * squre area or number occupied cells) and trying highest possible number
+ * was a correct answer.
+ *      440:    2304   2304   1701       1  0.7383 <--- right answer
+ *      441:    2400   3348   2401   1.395       1
+ * So the answer is the number of regions that have enough cells for all shapes.
+ */
+constexpr std::int64_t solve1(const Input& input)
+{
+    return std::ranges::count_if(computeStats(input),
+                                 [](const Stats& s)
+                                 { return s.requiredArea <= s.availableArea; });
+}
+
+constexpr Input readInput(std::string_view content)
+{
+    namespace rv = std::ranges::views;
+    namespace rng = std::ranges;
+
+    Input result;
+    auto lines = input::lines(content);
+    auto line = std::begin(lines);
+    for (std::size_t i = 0; i < numberOfShapes && line != std::end(lines); ++i)
+    {
+        std::vector<std::string> shape;
+        for (++line; line != std::end(lines) && not std::empty(*line); ++line)
+            shape.push_back(std::string{*line});
+        if (line != std::end(lines))
+            ++line;
+
+        auto area = aoc2025::algorithm::sum(
+            shape
+            | rv::transform([](const auto& row) { return rng::count(row, '#'); }));
+        result.shapes.push_back({
+            .height = std::ssize(shape),
+            .width = std::ssize(shape[0]),
+            .area = area,
+            .data = std::move(shape),
+        });
+    }
+    // 41x48: 29 35 26 36 38 44
+    for (; line != std::end(lines); ++line)
+    {
+        auto numbers = parse::parseIntegers<std::int64_t>(*line);
+        result.requirements.push_back({
+            .width = numbers[0],
+            .height = numbers[1],
+            .shapes = numbers | rv::drop(2) | rng::to<std::vector>()  //
+        });
+    }
+    return result;
+}
+}  // namespace aoc2025::day12
@@ -0,0 +1,26 @@
+#include "day12.h"
+
+#include "util/registry.h"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace aoc2025::day12
+{
+namespace
+{
+const registry::Registrar registrar{{
+    .name = "day12",
+    .day = 12,
+    .load =
+        [](std::string_view content)
+    {
+        auto input = std::make_shared<const Input>(readInput(content));
+        return std::vector{
+            registry::makePart(1, [input] { return solve1(*input); }),
+        };
+    },
+}};
+}  // namespace
+}  // namespace aoc2025::day12
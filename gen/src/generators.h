@@ -0,0 +1,397 @@
+#pragma once
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aoc2025::gen
+{
+/**
+ * Seeded source of the generators. mt19937_64 is fully specified by the standard and
+ * values are reduced with a plain modulo (std distributions differ between standard
+ * libraries), so a seed gives the same input everywhere.
+ */
+class Random
+{
+public:
+    explicit Random(std::uint64_t seed)
+        : engine_(seed)
+    {
+    }
+
+    // uniform in [lo, hi], the modulo bias is irrelevant for test data
+    std::int64_t between(std::int64_t lo, std::int64_t hi)
+    {
+        assert(lo <= hi && "empty interval");
+        auto range = static_cast<std::uint64_t>(hi - lo) + 1;
+        return lo + static_cast<std::int64_t>(engine_() % range);
+    }
+
+    bool chance(int percent) { return between(0, 99) < percent; }
+
+    template <typename T>
+    void shuffle(std::vector<T>& values)
+    {
+        for (auto i = std::ssize(values) - 1; i > 0; --i)
+            std::swap(values[i], values[between(0, i)]);
+    }
+
+private:
+    std::mt19937_64 engine_;
+};
+
+using Output = std::back_insert_iterator<std::string>;
+
+/**
+ * Dial rotations, one "L12"/"R345" per line.
+ */
+inline void day01(Random& random, std::int64_t size, Output out)
+{
+    for (std::int64_t i = 0; i < size; ++i)
+        fmt::format_to(out, "{}{}\n", random.chance(50) ? 'L' : 'R', random.between(1, 999));
+}
+
+// Largest id of day02, bounds have at most 10 digits
+constexpr std::int64_t day02Limit = 9'999'999'999;
+
+/**
+ * Disjoint id ranges "lo-hi" on one comma separated line, shuffled. Bounds have
+ * 1 to 10 digits, every range spans at most 10^6 ids. Range i lies in
+ * [1 + i * gap, (i + 1) * gap], so ranges need a gap of at least 2 ids.
+ */
+inline void day02(Random& random, std::int64_t size, Output out)
+{
+    auto gap = day02Limit / (size + 1);
+    assert(gap >= 2 && "too many ranges for 10 digit ids");
+    std::vector<std::pair<std::int64_t, std::int64_t>> ranges;
+    for (std::int64_t i = 0; i < size; ++i)
+    {
+        auto base = 1 + i * gap;
+        auto lo = base + random.between(0, gap / 2 - 1);
+        auto hi = lo + random.between(0, std::min<std::int64_t>(gap - (lo - base) - 1, 1'000'000));
+        ranges.emplace_back(lo, hi);
+    }
+    random.shuffle(ranges);
+    for (const auto& [lo, hi] : ranges)
+        fmt::format_to(out, "{}{}-{}", &lo == &ranges.front().first ? "" : ",", lo, hi);
+    fmt::format_to(out, "\n");
+}
+
+/**
+ * Battery banks, lines of 100 digits 1-9.
+ */
+inline void day03(Random& random, std::int64_t size, Output out)
+{
+    for (std::int64_t i = 0; i < size; ++i)
+    {
+        for (int j = 0; j < 100; ++j)
+            *out++ = static_cast<char>('0' + random.between(1, 9));
+        *out++ = '\n';
+    }
+}
+
+/**
+ * Square size x size grid of paper rolls '@' and empty cells '.'.
+ */
+inline void day04(Random& random, std::int64_t size, Output out)
+{
+    for (std::int64_t i = 0; i < size; ++i)
+    {
+        for (std::int64_t j = 0; j < size; ++j)
+            *out++ = random.chance(65) ? '@' : '.';
+        *out++ = '\n';
+    }
+}
+
+/**
+ * `size` fresh id ranges (overlapping), an empty line and `size` ids to check.
+ */
+inline void day05(Random& random, std::int64_t size, Output out)
+{
+    constexpr std::int64_t limit = 999'999'999'999'999;
+    for (std::int64_t i = 0; i < size; ++i)
+    {
+        auto lo = random.between(1, limit);
+        fmt::format_to(
+            out, "{}-{}\n", lo, std::min(lo + random.between(0, limit / (size + 1)), limit));
+    }
+    fmt::format_to(out, "\n");
+    for (std::int64_t i = 0; i < size; ++i)
+        fmt::format_to(out, "{}\n", random.between(1, limit));
+}
+
+/**
+ * Worksheet of `size` problems: four rows of numbers with up to four digits, aligned
+ * within every problem's columns, and a row of operators. Problems are separated by
+ * a column of spaces.
+ */
+inline void day06(Random& random, std::int64_t size, Output out)
+{
+    constexpr int rows = 4;
+    std::array<std::string, rows + 1> lines;
+    for (std::int64_t problem = 0; problem < size; ++problem)
+    {
+        std::array<std::string, rows> numbers;
+        for (auto& number : numbers)
+            number = fmt::format("{}", random.between(1, 9999));
+        auto width = std::ranges::max(numbers, {}, &std::string::size).size();
+        auto left = random.chance(50);
+        for (int row = 0; row < rows; ++row)
+        {
+            auto& line = lines[row];
+            line += problem == 0 ? "" : " ";
+            line += left ? fmt::format("{:<{}}", numbers[row], width)
+                         : fmt::format("{:>{}}", numbers[row], width);
+        }
+        lines[rows] += fmt::format(
+            "{}{:<{}}", problem == 0 ? "" : " ", random.chance(50) ? '*' : '+', width);
+    }
+    for (const auto& line : lines)
+        fmt::format_to(out, "{}\n", line);
+}
+
+/**
+ * Tachyon manifold `size` columns wide: the source 'S' in the middle of the first row
+ * and every other row with splitters '^', never on the border or next to each other.
+ * The manifold has at least as many rows as columns.
+ */
+inline void day07(Random& random, std::int64_t size, Output out)
+{
+    auto width = std::max<std::int64_t>(size, 3);
+    auto height = width + width % 2;
+    for (std::int64_t row = 0; row < height; ++row)
+    {
+        std::string line(static_cast<std::size_t>(width), '.');
+        if (row == 0)
+            line[static_cast<std::size_t>(width / 2)] = 'S';
+        else if (row % 2 == 0)
+        {
+            for (auto column = 1 + (row / 2) % 2; column + 1 < width; column += 2)
+                line[static_cast<std::size_t>(column)] = random.chance(40) ? '^' : '.';
+        }
+        fmt::format_to(out, "{}\n", line);
+    }
+}
+
+/**
+ * Junction boxes "x,y,z" with coordinates below 10^5.
+ */
+inline void day08(Random& random, std::int64_t size, Output out)
+{
+    for (std::int64_t i = 0; i < size; ++i)
+    {
+        fmt::format_to(out,
+                       "{},{},{}\n",
+                       random.between(0, 99'999),
+                       random.between(0, 99'999),
+                       random.between(0, 99'999));
+    }
+}
+
+/**
+ * Red tiles "x,y": the corners of a rectilinear polygon with (about) `size` corners,
+ * listed in order. The polygon is a histogram, a staircase on top of a flat bottom.
+ */
+inline void day09(Random& random, std::int64_t size, Output out)
+{
+    auto steps = std::max<std::int64_t>((size - 2) / 2, 1);
+    auto stride = std::max<std::int64_t>(99'999 / (steps + 1), 2);
+    std::int64_t bottom = random.between(1, 1000);
+    std::int64_t x = random.between(1, stride);
+    std::int64_t previous = 0;
+    std::vector<std::pair<std::int64_t, std::int64_t>> corners;
+    for (std::int64_t i = 0; i < steps; ++i)
+    {
+        auto y = previous;
+        while (y == previous)
+            y = random.between(bottom + 1, 99'999);
+        auto next = x + random.between(1, stride);
+        corners.emplace_back(x, y);
+        corners.emplace_back(next, y);
+        x = next;
+        previous = y;
+    }
+    corners.emplace_back(x, bottom);
+    corners.emplace_back(corners.front().first, bottom);
+    for (const auto& [cx, cy] : corners)
+        fmt::format_to(out, "{},{}\n", cx, cy);
+}
+
+/**
+ * Machines "[.##.] (3) (1,3) ... {3,5,4,7}" with 4 to 10 lights and at most 3 buttons
+ * more than lights, as in the puzzle: part 2 enumerates every combination of the free
+ * variables, so more buttons make it exponentially slower. Lights are the xor and
+ * joltages the sum of random button presses, so both parts have a solution.
+ */
+inline void day10(Random& random, std::int64_t size, Output out)
+{
+    for (std::int64_t machine = 0; machine < size; ++machine)
+    {
+        auto lights = random.between(4, 10);
+        auto buttonCount = random.between(lights - 2, lights + 3);
+        std::vector<std::vector<std::int64_t>> buttons;
+        std::vector<bool> covered(static_cast<std::size_t>(lights));
+        for (std::int64_t b = 0; b < buttonCount; ++b)
+        {
+            std::vector<std::int64_t> button;
+            for (std::int64_t light = 0; light < lights; ++light)
+            {
+                if (random.chance(40) || (b + 1 == buttonCount && not covered[light]))
+                    button.push_back(light);
+            }
+            if (std::empty(button))
+                button.push_back(random.between(0, lights - 1));
+            for (auto light : button)
+                covered[light] = true;
+            buttons.push_back(std::move(button));
+        }
+
+        std::vector<bool> state(static_cast<std::size_t>(lights));
+        std::vector<std::int64_t> joltages(static_cast<std::size_t>(lights));
+        for (const auto& button : buttons)
+        {
+            auto presses = random.between(0, 30);
+            for (auto light : button)
+            {
+                state[light] = state[light] != (presses % 2 == 1);
+                joltages[light] += presses;
+            }
+        }
+
+        *out++ = '[';
+        for (auto on : state)
+            *out++ = on ? '#' : '.';
+        *out++ = ']';
+        for (const auto& button : buttons)
+            fmt::format_to(out, " ({})", fmt::join(button, ","));
+        fmt::format_to(out, " {{{}}}\n", fmt::join(joltages, ","));
+    }
+}
+
+/**
+ * Device graph "abc: def ghi" with `size` devices in 40 layers, every device is
+ * connected to one or two devices of the next layer, so path counts fit 64 bits.
+ * A spine svr -> ... -> fft -> ... -> dac -> ... -> out guarantees paths for part 2,
+ * "you" starts next to svr; out has no outputs.
+ */
+inline void day11(Random& random, std::int64_t size, Output out)
+{
+    constexpr std::int64_t layers = 40;
+    auto width = std::max<std::int64_t>((size + layers - 2) / (layers - 1), 2);
+    // regular names have more than three letters and never clash with special ones
+    auto name = [](std::int64_t layer, std::int64_t index) -> std::string
+    {
+        if (layer == layers - 1)
+            return "out";
+        if (index == 0)
+        {
+            switch (layer)
+            {
+            case 0:
+                return "svr";
+            case layers / 3:
+                return "fft";
+            case 2 * layers / 3:
+                return "dac";
+            }
+        }
+        if (layer == 0 && index == 1)
+            return "you";
+
+        std::string result;
+        for (auto value = layer * 1'000'000'000 + index; result.size() < 4 || value > 0;
+             value /= 26)
+            result += static_cast<char>('a' + value % 26);
+        return result;
+    };
+
+    std::vector<std::int64_t> targets;
+    for (std::int64_t layer = 0; layer + 1 < layers; ++layer)
+    {
+        auto nextWidth = layer + 2 == layers ? 1 : width;
+        for (std::int64_t index = 0; index < width; ++index)
+        {
+            targets = {random.between(0, nextWidth - 1)};
+            if (index == 0)
+                targets.front() = 0;
+            if (random.chance(50) && nextWidth > 1)
+                targets.push_back(random.between(0, nextWidth - 1));
+            if (std::size(targets) == 2 && targets[0] == targets[1])
+                targets.pop_back();
+
+            fmt::format_to(out, "{}:", name(layer, index));
+            for (auto target : targets)
+                fmt::format_to(out, " {}", name(layer + 1, target));
+            *out++ = '\n';
+        }
+    }
+}
+
+/**
+ * Six 3x3 present shapes followed by `size` regions "WxH: c0 c1 c2 c3 c4 c5", about
+ * half of them with enough room.
+ */
+inline void day12(Random& random, std::int64_t size, Output out)
+{
+    for (int shape = 0; shape < 6; ++shape)
+    {
+        fmt::format_to(out, "{}:\n", shape);
+        for (int row = 0; row < 3; ++row)
+        {
+            for (int column = 0; column < 3; ++column)
+                *out++ = row == 1 || random.chance(70) ? '#' : '.';
+            *out++ = '\n';
+        }
+        *out++ = '\n';
+    }
+    for (std::int64_t i = 0; i < size; ++i)
+    {
+        auto width = random.between(35, 50);
+        auto height = random.between(35, 50);
+        // 9 cells per present, the total lands around the available area
+        auto budget = width * height * random.between(80, 120) / 100 / 9;
+        fmt::format_to(out, "{}x{}:", width, height);
+        for (int shape = 0; shape < 6; ++shape)
+            fmt::format_to(out, " {}", random.between(0, budget / 3));
+        *out++ = '\n';
+    }
+}
+
+struct Generator
+{
+    int day = 0;
+    std::int64_t defaultSize = 0;  // size of the actual puzzle input
+    std::function<void(Random&, std::int64_t, Output)> generate;
+    std::int64_t maxSize = std::numeric_limits<std::int64_t>::max();
+};
+
+inline const std::vector<Generator>& generators()
+{
+    static const std::vector<Generator> all{
+        {1, 4160, day01},
+        {2, 40, day02, day02Limit / 2 - 1},
+        {3, 200, day03},
+        {4, 140, day04},
+        {5, 1000, day05},
+        {6, 1000, day06},
+        {7, 142, day07},
+        {8, 1000, day08},
+        {9, 500, day09},
+        {10, 180, day10},
+        {11, 600, day11},
+        {12, 1000, day12},
+    };
+    return all;
+}
+}  // namespace aoc2025::gen
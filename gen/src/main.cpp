@@ -0,0 +1,132 @@
+#include "generators.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+namespace gen = aoc2025::gen;
+
+constexpr std::string_view usage =
+    "usage: aoc_gen [--day N]... [--size N] [--seed N] [--output-dir DIR]\n"
+    "Writes synthetic inputs for the selected days (all by default) to DIR/dayNN.txt.\n"
+    "Size is the number of lines or items (grid side for days 4 and 7), the puzzle's\n"
+    "size by default; the same seed always gives the same files.";
+
+struct Arguments
+{
+    std::vector<int> days;
+    std::optional<std::int64_t> size;
+    std::uint64_t seed = 2025;
+    std::string outputDir = ".";
+};
+
+template <typename T>
+std::optional<T> parseNumber(std::string_view value)
+{
+    T result = 0;
+    const auto* end = std::data(value) + std::size(value);
+    auto [ptr, ec] = std::from_chars(std::data(value), end, result);
+    if (ec != std::errc{} || ptr != end)
+        return std::nullopt;
+    return result;
+}
+
+std::optional<Arguments> parseArguments(std::span<char*> args)
+{
+    Arguments result;
+    for (std::size_t i = 0; i < std::size(args); ++i)
+    {
+        std::string_view name = args[i];
+        if (i + 1 == std::size(args))
+            return std::nullopt;
+        std::string_view value = args[++i];
+
+        if (name == "--day")
+        {
+            auto day = parseNumber<int>(value);
+            if (not day || *day <= 0)
+                return std::nullopt;
+            result.days.push_back(*day);
+        }
+        else if (name == "--size")
+        {
+            auto size = parseNumber<std::int64_t>(value);
+            if (not size || *size <= 0)
+                return std::nullopt;
+            result.size = *size;
+        }
+        else if (name == "--seed")
+        {
+            auto seed = parseNumber<std::uint64_t>(value);
+            if (not seed)
+                return std::nullopt;
+            result.seed = *seed;
+        }
+        else if (name == "--output-dir")
+            result.outputDir = value;
+        else
+            return std::nullopt;
+    }
+    return result;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    auto arguments = parseArguments(std::span{argv + 1, argv + argc});
+    if (not arguments)
+    {
+        fmt::println("{}", usage);
+        return 1;
+    }
+
+    auto generated = 0;
+    for (const auto& generator : gen::generators())
+    {
+        if (not std::empty(arguments->days)
+            && not std::ranges::contains(arguments->days, generator.day))
+            continue;
+
+        // every day has its own stream, so selecting days does not change the content
+        gen::Random random{arguments->seed * 100 + static_cast<std::uint64_t>(generator.day)};
+        auto size = arguments->size.value_or(generator.defaultSize);
+        if (size > generator.maxSize)
+        {
+            fmt::println("day{:02}: size {} is above the maximum of {}",
+                         generator.day,
+                         size,
+                         generator.maxSize);
+            return 1;
+        }
+        std::string content;
+        generator.generate(random, size, std::back_inserter(content));
+
+        auto path = fmt::format("{}/day{:02}.txt", arguments->outputDir, generator.day);
+        std::ofstream file(path, std::ios::binary);
+        file << content;
+        if (not file)
+        {
+            fmt::println("Failed to write {}", path);
+            return 1;
+        }
+        fmt::println(
+            "day{:02}: size {}, {} bytes -> {}", generator.day, size, std::size(content), path);
+        ++generated;
+    }
+    if (generated == 0)
+    {
+        fmt::println("no generator matches the selected days");
+        return 1;
+    }
+    return 0;
+}
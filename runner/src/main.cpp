@@ -0,0 +1,375 @@
+#include "util/allocations.h"
+#include "util/input.h"
+#include "util/parallel.h"
+#include "util/perfcounters.h"
+#include "util/registry.h"
+#include "util/stopwatch.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+namespace registry = aoc2025::registry;
+namespace input = aoc2025::input;
+namespace time = aoc2025::time;
+namespace memory = aoc2025::memory;
+
+constexpr std::string_view usage =
+    "usage: aoc [--day N]... [--part N] [--input-dir DIR] [--input N=FILE]...\n"
+    "           [--threads N] [--sequential] [--counters] [--cross-check]\n"
+    "Runs the selected days (all by default) and prints answers with parse and solve times.\n"
+    "Inputs are read from DIR/dayNN.txt unless --input gives a file for day N.\n"
+    "Days run concurrently on the thread pool unless --sequential is given; parallel\n"
+    "solvers use N threads ($AOC_THREADS or all cores by default).\n"
+    "--counters adds hardware counters (perf_event_open) of every phase; they cover the\n"
+    "thread running the phase, use --threads 1 to count all of the work.\n"
+    "Heap allocations of every phase, including the pool workers it uses, are reported\n"
+    "when built with AOC_ALLOCATION_ACCOUNTING.\n"
+    "--cross-check also compares the answers with the reference solvers of the days that\n"
+    "have one (e.g. day 2 brute force), which can take much longer.";
+
+using Microseconds = std::chrono::duration<double, std::micro>;
+
+struct Arguments
+{
+    std::vector<int> days;
+    std::optional<int> part;
+    std::string inputDir = ".";
+    std::map<int, std::string> inputs;
+    bool sequential = false;
+    bool counters = false;
+    bool crossCheck = false;
+};
+
+std::optional<int> parseCount(std::string_view value)
+{
+    int result = 0;
+    const auto* end = std::data(value) + std::size(value);
+    auto [ptr, ec] = std::from_chars(std::data(value), end, result);
+    if (ec != std::errc{} || ptr != end || result < 0)
+        return std::nullopt;
+    return result;
+}
+
+std::optional<Arguments> parseArguments(std::span<char*> args)
+{
+    Arguments result;
+    for (std::size_t i = 0; i < std::size(args); ++i)
+    {
+        std::string_view name = args[i];
+        if (name == "--sequential")
+        {
+            result.sequential = true;
+            continue;
+        }
+        if (name == "--counters")
+        {
+            result.counters = true;
+            continue;
+        }
+        if (name == "--cross-check")
+        {
+            result.crossCheck = true;
+            continue;
+        }
+        if (i + 1 == std::size(args))
+            return std::nullopt;
+        std::string_view value = args[++i];
+
+        if (name == "--day")
+        {
+            auto day = parseCount(value);
+            if (not day || *day == 0)
+                return std::nullopt;
+            result.days.push_back(*day);
+        }
+        else if (name == "--part")
+        {
+            auto part = parseCount(value);
+            if (not part || *part == 0)
+                return std::nullopt;
+            result.part = *part;
+        }
+        else if (name == "--input-dir")
+            result.inputDir = value;
+        else if (name == "--input")
+        {
+            auto separator = value.find('=');
+            auto day = parseCount(value.substr(0, separator));
+            if (separator == std::string_view::npos || not day)
+                return std::nullopt;
+            result.inputs[*day] = std::string{value.substr(separator + 1)};
+        }
+        else if (name == "--threads")
+        {
+            auto count = parseCount(value);
+            if (not count || *count == 0)
+                return std::nullopt;
+            aoc2025::parallel::setThreadCount(*count);
+        }
+        else
+            return std::nullopt;
+    }
+    return result;
+}
+
+struct Measurement
+{
+    Microseconds time{};
+    time::CounterValues counters;
+    memory::AllocationStats allocations;
+};
+
+struct PartResult
+{
+    int number = 0;
+    std::string answer;
+    Measurement solve;
+};
+
+struct Run
+{
+    const registry::Solution* solution = nullptr;
+    std::string path;
+    std::optional<std::string> error;
+    Measurement parse;
+    std::vector<PartResult> parts;
+};
+
+template <std::invocable F>
+auto measure(bool withCounters, Measurement& measurement, F&& function)
+{
+    std::optional<time::PerfCounters> counters;
+    if (withCounters)
+        counters.emplace();
+    memory::AllocationScope allocations;
+    time::Stopwatch<> stopwatch;
+    auto result = function();
+    measurement.time = stopwatch.elapsed<Microseconds>();
+    measurement.allocations = allocations.elapsed();
+    if (counters)
+        measurement.counters = counters->elapsed();
+    return result;
+}
+
+/**
+ * Loads the input and solves the selected parts; the content outlives the parts,
+ * which may keep views into it.
+ */
+void execute(Run& run, const Arguments& arguments)
+{
+    if (run.error)
+        return;
+
+    auto file = input::InputFile::open(run.path);
+    if (not file)
+    {
+        run.error = fmt::format("no input at {}", run.path);
+        return;
+    }
+
+    auto parts = measure(
+        arguments.counters, run.parse, [&] { return run.solution->load(file->content()); });
+    if (std::empty(parts))
+    {
+        run.error = fmt::format("failed to parse {}", run.path);
+        return;
+    }
+
+    for (const auto& part : parts)
+    {
+        if (arguments.part && part.number != *arguments.part)
+            continue;
+        auto& result = run.parts.emplace_back(PartResult{.number = part.number});
+        result.answer = measure(arguments.counters, result.solve, part.solve);
+    }
+
+    // after the timed parts, the reference solvers are not measured
+    if (arguments.crossCheck && run.solution->crossCheck
+        && not run.solution->crossCheck(file->content()))
+        run.error = "cross-check failed, answers differ from the reference solver";
+}
+
+void printReport(std::span<const Run> runs, Microseconds wall)
+{
+    fmt::println("{:<10}{:>5}{:>22}{:>14}{:>14}",  //
+                 "solution",
+                 "part",
+                 "answer",
+                 "parse (us)",
+                 "solve (us)");
+    Microseconds parseTotal{};
+    Microseconds solveTotal{};
+    for (const auto& run : runs)
+    {
+        if (run.error)
+        {
+            fmt::println("{:<10}{:>5}  {}", run.solution->name, "-", *run.error);
+            continue;
+        }
+        parseTotal += run.parse.time;
+        for (const auto& part : run.parts)
+        {
+            // the parse time is shown once per solution, all parts share the parsed input
+            auto parse = &part == std::data(run.parts)
+                             ? fmt::format("{:.1f}", run.parse.time.count())
+                             : std::string{};
+            fmt::println("{:<10}{:>5}{:>22}{:>14}{:>14.1f}",
+                         run.solution->name,
+                         part.number,
+                         part.answer,
+                         parse,
+                         part.solve.time.count());
+            solveTotal += part.solve.time;
+        }
+    }
+    fmt::println("{:<10}{:>5}{:>22}{:>14.1f}{:>14.1f}",
+                 "sum",
+                 "",
+                 "",
+                 parseTotal.count(),
+                 solveTotal.count());
+    fmt::println("wall time: {:.1f} us", wall.count());
+    if (auto rss = memory::peakRss())
+        fmt::println("peak RSS: {} KiB", *rss / 1024);
+}
+
+void printAllocations(std::span<const Run> runs)
+{
+    auto print = [](std::string_view name, std::string_view phase, const auto& stats)
+    {
+        fmt::println("{:<10}{:>7}{:>14}{:>16}{:>16}",
+                     name,
+                     phase,
+                     stats.count,
+                     stats.bytes,
+                     stats.peakBytes);
+    };
+    fmt::println("{:<10}{:>7}{:>14}{:>16}{:>16}",  //
+                 "solution",
+                 "phase",
+                 "allocations",
+                 "bytes",
+                 "peak bytes");
+    for (const auto& run : runs)
+    {
+        if (run.error)
+            continue;
+        print(run.solution->name, "parse", run.parse.allocations);
+        for (const auto& part : run.parts)
+            print(run.solution->name, fmt::format("part{}", part.number), part.solve.allocations);
+    }
+}
+
+void printCounters(std::span<const Run> runs)
+{
+    if (not time::PerfCounters{}.available())
+    {
+        fmt::println("hardware counters are not available (perf_event_paranoid, container?)");
+        return;
+    }
+
+    auto count = [](std::optional<std::uint64_t> value)
+    { return value ? fmt::format("{}", *value) : std::string{"-"}; };
+    auto print = [&](std::string_view name, std::string_view phase, const time::CounterValues& c)
+    {
+        fmt::println("{:<10}{:>7}{:>15}{:>15}{:>6}{:>13}{:>13}{:>13}",
+                     name,
+                     phase,
+                     count(c.cycles),
+                     count(c.instructions),
+                     c.ipc().transform([](double ipc) { return fmt::format("{:.2f}", ipc); })
+                         .value_or("-"),
+                     count(c.l1dMisses),
+                     count(c.llcMisses),
+                     count(c.branchMisses));
+    };
+    fmt::println("{:<10}{:>7}{:>15}{:>15}{:>6}{:>13}{:>13}{:>13}",
+                 "solution",
+                 "phase",
+                 "cycles",
+                 "instructions",
+                 "IPC",
+                 "L1D misses",
+                 "LLC misses",
+                 "br misses");
+    for (const auto& run : runs)
+    {
+        if (run.error)
+            continue;
+        print(run.solution->name, "parse", run.parse.counters);
+        for (const auto& part : run.parts)
+            print(run.solution->name, fmt::format("part{}", part.number), part.solve.counters);
+    }
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    auto arguments = parseArguments(std::span{argv + 1, argv + argc});
+    if (not arguments)
+    {
+        fmt::println("{}", usage);
+        return 1;
+    }
+
+    auto solutions = registry::sortedSolutions();
+    std::vector<Run> runs;
+    for (const auto& solution : solutions)
+    {
+        if (not std::empty(arguments->days)
+            && not std::ranges::contains(arguments->days, solution.day))
+            continue;
+
+        auto input = arguments->inputs.find(solution.day);
+        runs.push_back({
+            .solution = &solution,
+            .path = input != std::end(arguments->inputs)
+                        ? input->second
+                        : fmt::format("{}/day{:02}.txt", arguments->inputDir, solution.day),
+        });
+    }
+    if (std::empty(runs))
+    {
+        fmt::println("no solution matches the selected days");
+        return 1;
+    }
+
+    for (auto& run : runs)
+    {
+        if (run.solution->selfCheck && not run.solution->selfCheck())
+            run.error = "self-check failed, run-time kernels disagree with the reference";
+    }
+
+    time::Stopwatch<> wall;
+    if (arguments->sequential)
+    {
+        for (auto& run : runs)
+            execute(run, *arguments);
+    }
+    else
+    {
+        aoc2025::parallel::forEachIndex(std::size(runs),
+                                        [&](std::size_t i) { execute(runs[i], *arguments); });
+    }
+    printReport(runs, wall.elapsed<Microseconds>());
+    if (memory::accountingEnabled())
+        printAllocations(runs);
+    if (arguments->counters)
+        printCounters(runs);
+
+    auto failed = std::ranges::any_of(runs, [](const Run& run) { return run.error.has_value(); });
+    return failed ? 1 : 0;
+}
@@ -1,7 +1,18 @@
 #pragma once
 
+#include "util/parallel.h"
+
 #include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
 #include <ranges>
+#include <utility>
+#include <vector>
 
 namespace aoc2025::algorithm
 {
@@ -13,4 +24,60 @@ constexpr auto sum(R&& rng, std::ranges::range_value_t<R> init = {})
         init,
         std::plus<>{});
 }
-}  // namespace aoc2025::algorithm
\ No newline at end of file
+
+/**
+ * Parallel counterparts for random access ranges of expensive elements (e.g. a
+ * transform over per-line solvers), see parallel::parallelTransformReduce.
+ * The reduction order is fixed, so results are reproducible for any thread count;
+ * in constant evaluated context this is the sequential fold.
+ */
+template <std::ranges::random_access_range R,
+          typename T,
+          typename Reduce,
+          typename Transform = std::identity>
+    requires std::ranges::sized_range<R>
+constexpr T parallelTransformReduce(R&& rng, T init, Reduce reduce, Transform transform = {})
+{
+    return parallel::parallelTransformReduce(
+        std::forward<R>(rng), std::move(init), std::move(reduce), std::move(transform));
+}
+
+template <std::ranges::random_access_range R>
+    requires std::ranges::sized_range<R>
+constexpr auto parallelSum(R&& rng, std::ranges::range_value_t<R> init = {})
+{
+    return parallelTransformReduce(std::forward<R>(rng), init, std::plus<>{});
+}
+
+template <std::ranges::random_access_range R>
+    requires std::ranges::sized_range<R>
+constexpr auto parallelMax(R&& rng)
+{
+    assert(not std::ranges::empty(rng) && "max of an empty range");
+    std::ranges::range_value_t<R> init = *std::ranges::begin(rng);
+    return parallelTransformReduce(std::forward<R>(rng),
+                                   init,
+                                   [](auto lhs, auto rhs) { return std::max(lhs, rhs); });
+}
+
+template <std::ranges::random_access_range R, typename Predicate>
+    requires std::ranges::sized_range<R>
+constexpr auto parallelCountIf(R&& rng, Predicate predicate)
+{
+    return parallelTransformReduce(
+        std::forward<R>(rng),
+        std::ranges::range_difference_t<R>{},
+        std::plus<>{},
+        [&](const auto& value) -> std::ranges::range_difference_t<R>
+        { return std::invoke(predicate, value) ? 1 : 0; });
+}
+
+static_assert(parallelSum(std::views::iota(1, 101)) == 5050);
+static_assert(parallelMax(std::array{3, 9, 2}) == 9);
+static_assert(parallelCountIf(std::views::iota(0, 10), [](int x) { return x % 3 == 0; }) == 4);
+static_assert(parallelTransformReduce(std::array{1, 2, 3},
+                                      std::int64_t{},
+                                      std::plus<>{},
+                                      [](int x) { return std::int64_t{x} * x; })
+              == 14);
+}  // namespace aoc2025::algorithm
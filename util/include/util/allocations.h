@@ -0,0 +1,137 @@
+#pragma once
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+namespace aoc2025::memory
+{
+/**
+ * Heap usage of a scope: number of allocations, bytes allocated and the peak of bytes
+ * live at the same time (above what was live when the scope started).
+ */
+struct AllocationStats
+{
+    std::uint64_t count = 0;
+    std::uint64_t bytes = 0;
+    std::uint64_t peakBytes = 0;
+};
+
+namespace detail
+{
+// Counters of one AllocationScope, shared by every thread working for it: the scope
+// binds its own thread, parallel::forEachIndex binds the workers helping with a loop.
+// Memory freed by another phase than the one that allocated it lowers this one's live.
+struct Phase
+{
+    Phase* parent = nullptr;  // enclosing scope, which counts everything this one does
+    std::atomic<std::uint64_t> count = 0;
+    std::atomic<std::uint64_t> bytes = 0;
+    std::atomic<std::int64_t> live = 0;
+    std::atomic<std::int64_t> peak = 0;
+};
+inline constinit thread_local Phase* currentPhase = nullptr;
+
+// Set by the replacement operators (util::allocations) when they are linked in
+inline std::atomic<bool> installed = false;
+
+inline void recordAllocation(std::size_t size)
+{
+    auto bytes = static_cast<std::int64_t>(size);
+    for (auto* phase = currentPhase; phase != nullptr; phase = phase->parent)
+    {
+        phase->count.fetch_add(1, std::memory_order_relaxed);
+        phase->bytes.fetch_add(size, std::memory_order_relaxed);
+        auto live = phase->live.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        auto peak = phase->peak.load(std::memory_order_relaxed);
+        while (live > peak
+               && not phase->peak.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+        {
+        }
+    }
+}
+
+inline void recordDeallocation(std::size_t size)
+{
+    for (auto* phase = currentPhase; phase != nullptr; phase = phase->parent)
+        phase->live.fetch_sub(static_cast<std::int64_t>(size), std::memory_order_relaxed);
+}
+
+/**
+ * Counts the allocations of the calling thread into `phase` while alive.
+ */
+class PhaseBinding
+{
+public:
+    explicit PhaseBinding(Phase* phase)
+        : previous_(std::exchange(currentPhase, phase))
+    {
+    }
+
+    PhaseBinding(const PhaseBinding&) = delete;
+    PhaseBinding& operator=(const PhaseBinding&) = delete;
+
+    ~PhaseBinding() { currentPhase = previous_; }
+
+private:
+    Phase* previous_ = nullptr;
+};
+}  // namespace detail
+
+/**
+ * Whether global operator new/delete are replaced by the accounting ones, otherwise
+ * every AllocationScope reports zeros. Opt in with -DAOC_ALLOCATION_ACCOUNTING=ON.
+ */
+inline bool accountingEnabled()
+{
+    return detail::installed.load(std::memory_order_relaxed);
+}
+
+/**
+ * A Stopwatch for the heap: elapsed() returns allocations since the scope was created,
+ * of the calling thread and of the pool workers running its parallel loops. Scopes nest
+ * and have to end on the thread that created them, in reverse order.
+ */
+class AllocationScope
+{
+public:
+    AllocationScope()
+    {
+        phase_.parent = std::exchange(detail::currentPhase, &phase_);
+    }
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+    ~AllocationScope() { detail::currentPhase = phase_.parent; }
+
+    AllocationStats elapsed() const
+    {
+        auto peak = phase_.peak.load(std::memory_order_relaxed);
+        return {
+            .count = phase_.count.load(std::memory_order_relaxed),
+            .bytes = phase_.bytes.load(std::memory_order_relaxed),
+            .peakBytes = static_cast<std::uint64_t>(std::max<std::int64_t>(peak, 0)),
+        };
+    }
+
+private:
+    detail::Phase phase_;
+};
+
+/**
+ * Peak resident set size of the process in bytes.
+ */
+inline std::optional<std::uint64_t> peakRss()
+{
+    rusage usage{};
+    if (::getrusage(RUSAGE_SELF, &usage) != 0)
+        return std::nullopt;
+    return static_cast<std::uint64_t>(usage.ru_maxrss) * 1024;  // kilobytes on Linux
+}
+}  // namespace aoc2025::memory
@@ -0,0 +1,255 @@
+#pragma once
+
+#include "util/stopwatch.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace aoc2025::bench
+{
+using Nanoseconds = std::chrono::duration<double, std::nano>;
+
+struct Options
+{
+    int warmup = 3;
+    int iterations = 25;
+};
+
+/**
+ * Summary of repeated runs of a single benchmark, all values are in nanoseconds.
+ */
+struct Statistics
+{
+    std::string name;
+    int iterations = 0;
+    double min = 0;
+    double median = 0;
+    double p99 = 0;
+    double max = 0;
+    double mean = 0;
+    double stddev = 0;
+};
+
+/**
+ * Median time per benchmark name, loaded from a previously stored report.
+ */
+using Baseline = std::unordered_map<std::string, double>;
+
+/**
+ * Keeps the compiler from discarding a value that is computed only to be timed.
+ */
+template <typename T>
+void doNotOptimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Linear interpolation between the closest ranks of sorted samples.
+ */
+constexpr double percentile(std::span<const double> sorted, double p)
+{
+    assert(not std::empty(sorted) && "no samples");
+    assert(p >= 0 && p <= 1 && "percentile must be in [0, 1]");
+    auto rank = p * static_cast<double>(std::size(sorted) - 1);
+    auto lo = static_cast<std::size_t>(rank);
+    auto hi = std::min(lo + 1, std::size(sorted) - 1);
+    return sorted[lo] + (sorted[hi] - sorted[lo]) * (rank - static_cast<double>(lo));
+}
+static_assert(percentile(std::to_array({1.0, 2.0, 3.0}), 0.5) == 2.0);
+static_assert(percentile(std::to_array({1.0, 2.0, 3.0, 4.0}), 0.5) == 2.5);
+static_assert(percentile(std::to_array({1.0, 2.0, 3.0}), 1.0) == 3.0);
+static_assert(percentile(std::to_array({5.0}), 0.99) == 5.0);
+
+constexpr double mean(std::span<const double> samples)
+{
+    assert(not std::empty(samples) && "no samples");
+    return std::ranges::fold_left(samples, 0.0, std::plus<>{})
+           / static_cast<double>(std::size(samples));
+}
+static_assert(mean(std::to_array({1.0, 2.0, 3.0})) == 2.0);
+
+/**
+ * Unbiased sample variance (zero for a single sample).
+ */
+constexpr double variance(std::span<const double> samples)
+{
+    if (std::size(samples) < 2)
+        return 0;
+    auto average = mean(samples);
+    return std::ranges::fold_left(  //
+               samples,
+               0.0,
+               [average](auto acc, auto value)
+               { return acc + (value - average) * (value - average); })
+           / static_cast<double>(std::size(samples) - 1);
+}
+static_assert(variance(std::to_array({2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0})) == 32.0 / 7);
+static_assert(variance(std::to_array({3.0})) == 0);
+
+inline Statistics summarize(std::string name, std::vector<double> samples)
+{
+    std::ranges::sort(samples);
+    return {
+        .name = std::move(name),
+        .iterations = static_cast<int>(std::size(samples)),
+        .min = samples.front(),
+        .median = percentile(samples, 0.5),
+        .p99 = percentile(samples, 0.99),
+        .max = samples.back(),
+        .mean = mean(samples),
+        .stddev = std::sqrt(variance(samples)),
+    };
+}
+
+template <std::invocable F>
+void runOnce(F& function)
+{
+    if constexpr (std::is_void_v<std::invoke_result_t<F&>>)
+        std::invoke(function);
+    else
+        doNotOptimize(std::invoke(function));
+}
+
+/**
+ * Runs `function` options.warmup times untimed, then times every one of
+ * options.iterations runs separately.
+ */
+template <std::invocable F>
+std::vector<double> measure(F&& function, const Options& options)
+{
+    assert(options.iterations > 0 && "at least one iteration is required");
+    for (int i = 0; i < options.warmup; ++i)
+        runOnce(function);
+
+    std::vector<double> samples;
+    samples.reserve(options.iterations);
+    for (int i = 0; i < options.iterations; ++i)
+    {
+        time::Stopwatch<> stopwatch;
+        runOnce(function);
+        samples.push_back(stopwatch.elapsed<Nanoseconds>().count());
+    }
+    return samples;
+}
+
+template <std::invocable F>
+Statistics run(std::string name, F&& function, const Options& options)
+{
+    return summarize(std::move(name), measure(std::forward<F>(function), options));
+}
+
+inline std::optional<double> deltaPercent(const Statistics& stats, const Baseline& baseline)
+{
+    auto it = baseline.find(stats.name);
+    if (it == std::end(baseline) || it->second <= 0)
+        return std::nullopt;
+    return (stats.median - it->second) / it->second * 100;
+}
+
+/**
+ * Serializes results; benchmark names are identifiers and are not escaped.
+ */
+inline std::string toJson(std::span<const Statistics> results, const Baseline& baseline = {})
+{
+    std::string json = "{\n  \"benchmarks\": [";
+    auto out = std::back_inserter(json);
+    for (const auto& stats : results)
+    {
+        fmt::format_to(out,
+                       "{}\n    {{\"name\": \"{}\", \"iterations\": {}, \"min_ns\": {:.1f}, "
+                       "\"median_ns\": {:.1f}, \"p99_ns\": {:.1f}, \"max_ns\": {:.1f}, "
+                       "\"mean_ns\": {:.1f}, \"stddev_ns\": {:.1f}",
+                       &stats == std::data(results) ? "" : ",",
+                       stats.name,
+                       stats.iterations,
+                       stats.min,
+                       stats.median,
+                       stats.p99,
+                       stats.max,
+                       stats.mean,
+                       stats.stddev);
+        if (auto delta = deltaPercent(stats, baseline))
+            fmt::format_to(out, ", \"delta_pct\": {:.2f}", *delta);
+        json += '}';
+    }
+    json += "\n  ]\n}\n";
+    return json;
+}
+
+/**
+ * Reads median times back from a report produced by toJson.
+ */
+inline Baseline parseBaseline(std::string_view json)
+{
+    constexpr std::string_view nameKey = R"("name": ")";
+    constexpr std::string_view medianKey = R"("median_ns": )";
+
+    Baseline baseline;
+    for (auto pos = json.find(nameKey); pos != std::string_view::npos;
+         pos = json.find(nameKey, pos))
+    {
+        pos += std::size(nameKey);
+        auto nameEnd = json.find('"', pos);
+        auto median = json.find(medianKey, nameEnd);
+        if (median == std::string_view::npos)
+            break;
+
+        median += std::size(medianKey);
+        double value = 0;
+        auto [_, ec] = std::from_chars(
+            std::data(json) + median, std::data(json) + std::size(json), value);
+        if (ec == std::errc{})
+            baseline.emplace(json.substr(pos, nameEnd - pos), value);
+        pos = median;
+    }
+    return baseline;
+}
+
+inline void printReport(std::span<const Statistics> results, const Baseline& baseline = {})
+{
+    constexpr auto toMicroseconds = [](double ns) { return ns / 1000; };
+    fmt::println("{:<16}{:>7}{:>12}{:>12}{:>12}{:>12}{:>12}{:>9}",
+                 "benchmark (us)",
+                 "runs",
+                 "min",
+                 "median",
+                 "p99",
+                 "max",
+                 "stddev",
+                 "delta");
+    for (const auto& stats : results)
+    {
+        auto delta = deltaPercent(stats, baseline)
+                         .transform([](double value) { return fmt::format("{:+.1f}%", value); })
+                         .value_or("-");
+        fmt::println("{:<16}{:>7}{:>12.3f}{:>12.3f}{:>12.3f}{:>12.3f}{:>12.3f}{:>9}",
+                     stats.name,
+                     stats.iterations,
+                     toMicroseconds(stats.min),
+                     toMicroseconds(stats.median),
+                     toMicroseconds(stats.p99),
+                     toMicroseconds(stats.max),
+                     toMicroseconds(stats.stddev),
+                     delta);
+    }
+}
+
+}  // namespace aoc2025::bench
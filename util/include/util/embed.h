@@ -0,0 +1,26 @@
+#pragma once
+
+#include <iterator>
+#include <string_view>
+
+#ifndef AOC_INPUT_FILE
+#error "AOC_INPUT_FILE has to name the input file to embed"
+#endif
+
+namespace aoc2025::embed
+{
+namespace detail
+{
+// Inputs are ASCII, a trailing zero keeps the array valid for empty files
+inline constexpr char inputData[] = {
+#embed AOC_INPUT_FILE suffix(, )
+    '\0'};
+}  // namespace detail
+
+/**
+ * Content of AOC_INPUT_FILE, embedded at compile time so solvers can run in constant
+ * evaluation (see aoc_add_compile_time_solution in the top-level CMakeLists.txt).
+ */
+inline constexpr std::string_view input{std::data(detail::inputData),
+                                        std::size(detail::inputData) - 1};
+}  // namespace aoc2025::embed
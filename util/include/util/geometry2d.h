@@ -1,9 +1,18 @@
 #pragma once
 
 #include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
 
 namespace aoc2025::geometry2d
 {
@@ -41,4 +50,125 @@ constexpr auto area(const Box& box)
     return (box.hi.x - box.lo.x + 1) * (box.hi.y - box.lo.y + 1);
 }
 
-}  // namespace aoc2025::geometry2d
\ No newline at end of file
+/**
+ * Structure of arrays copy of points for batched kernels (one point against a block
+ * of consecutive points).
+ */
+class PointCloud2d
+{
+public:
+    // Side lengths of boxes between such points fit into 32 bits, which AVX2 can multiply
+    static constexpr std::int64_t narrowLimit = std::int64_t{1} << 30;
+
+    static constexpr bool isNarrow(const Point& point)
+    {
+        auto fits = [](std::int64_t value) { return value > -narrowLimit && value < narrowLimit; };
+        return fits(point.x) && fits(point.y);
+    }
+
+    constexpr explicit PointCloud2d(std::span<const Point> points)
+    {
+        x_.reserve(std::size(points));
+        y_.reserve(std::size(points));
+        for (const auto& point : points)
+        {
+            x_.push_back(point.x);
+            y_.push_back(point.y);
+            narrow_ = narrow_ && isNarrow(point);
+        }
+    }
+
+    constexpr std::size_t size() const { return std::size(x_); }
+    constexpr Point operator[](std::size_t i) const { return {x_[i], y_[i]}; }
+    constexpr const std::int64_t* xs() const { return std::data(x_); }
+    constexpr const std::int64_t* ys() const { return std::data(y_); }
+    constexpr bool narrow() const { return narrow_; }
+
+private:
+    std::vector<std::int64_t> x_;
+    std::vector<std::int64_t> y_;
+    bool narrow_ = true;
+};
+
+namespace detail
+{
+/**
+ * Vectorized prefix of the batched kernel, returns how many outputs it wrote.
+ */
+inline std::size_t areaVectorized(const Point& point,
+                                  const PointCloud2d& cloud,
+                                  std::size_t first,
+                                  std::span<std::int64_t> out)
+{
+    std::size_t k = 0;
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+    auto zero = _mm512_setzero_si512();
+    auto one = _mm512_set1_epi64(1);
+    auto side = [&](const std::int64_t* data, __m512i coordinate)
+    {
+        // masked negation: _mm512_abs_epi64 trips -Wmaybe-uninitialized in GCC 12 headers
+        auto delta = _mm512_sub_epi64(_mm512_loadu_si512(data + first + k), coordinate);
+        auto negative = _mm512_cmplt_epi64_mask(delta, zero);
+        return _mm512_add_epi64(_mm512_mask_sub_epi64(delta, negative, zero, delta), one);
+    };
+    auto px = _mm512_set1_epi64(point.x);
+    auto py = _mm512_set1_epi64(point.y);
+    for (; k + 8 <= std::size(out); k += 8)
+    {
+        auto product = _mm512_mullo_epi64(side(cloud.xs(), px), side(cloud.ys(), py));
+        _mm512_storeu_si512(std::data(out) + k, product);
+    }
+#elif defined(__AVX2__)
+    // no 64-bit multiply, sides are multiplied as unsigned 32-bit values
+    if (not cloud.narrow() || not PointCloud2d::isNarrow(point))
+        return 0;
+
+    auto zero = _mm256_setzero_si256();
+    auto one = _mm256_set1_epi64x(1);
+    auto side = [&](const std::int64_t* data, __m256i coordinate)
+    {
+        auto delta = _mm256_sub_epi64(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + first + k)), coordinate);
+        auto sign = _mm256_cmpgt_epi64(zero, delta);
+        return _mm256_add_epi64(_mm256_sub_epi64(_mm256_xor_si256(delta, sign), sign), one);
+    };
+    auto px = _mm256_set1_epi64x(point.x);
+    auto py = _mm256_set1_epi64x(point.y);
+    for (; k + 4 <= std::size(out); k += 4)
+    {
+        auto product = _mm256_mul_epu32(side(cloud.xs(), px), side(cloud.ys(), py));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(std::data(out) + k), product);
+    }
+#endif
+    return k;
+}
+}  // namespace detail
+
+/**
+ * out[k] = area of the box spanned by point and cloud[first + k].
+ * AVX-512/AVX2 at runtime, scalar in constant evaluated context and for the tail.
+ */
+constexpr void area(const Point& point,
+                    const PointCloud2d& cloud,
+                    std::size_t first,
+                    std::span<std::int64_t> out)
+{
+    assert(first + std::size(out) <= std::size(cloud) && "block is out of the cloud");
+    std::size_t k = 0;
+    if (not std::is_constant_evaluated())
+        k = detail::areaVectorized(point, cloud, first, out);
+    for (; k < std::size(out); ++k)
+        out[k] = area(point, cloud[first + k]);
+}
+
+static_assert(
+    []
+    {
+        std::vector<Point> points{{7, 1}, {11, 1}, {11, 7}, {2, 3}};
+        PointCloud2d cloud{points};
+        std::vector<std::int64_t> out(3);
+        area({7, 1}, cloud, 1, out);
+        return out == std::vector<std::int64_t>{5, 35, 18};
+    }());
+
+}  // namespace aoc2025::geometry2d
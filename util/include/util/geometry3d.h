@@ -1,7 +1,16 @@
 #pragma once
 
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <tuple>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
 
 namespace aoc2025::geometry3d
 {
@@ -25,4 +34,125 @@ constexpr auto euclideanDistanceSquare(const Point& a, const Point& b)
 static_assert(euclideanDistanceSquare({0, 0, 0}, {0, 0, 0}) == 0);
 static_assert(euclideanDistanceSquare({0, 0, 0}, {1, 1, 1}) == 3);
 static_assert(euclideanDistanceSquare({1, 2, 3}, {4, 5, 6}) == 27);
-}  // namespace aoc2025::geometry3d
\ No newline at end of file
+
+/**
+ * Structure of arrays copy of points for batched kernels (one point against a block
+ * of consecutive points).
+ */
+class PointCloud3d
+{
+public:
+    // Differences of such coordinates fit into 32 bits, which AVX2 can multiply
+    static constexpr std::int64_t narrowLimit = std::int64_t{1} << 30;
+
+    static constexpr bool isNarrow(const Point& point)
+    {
+        auto fits = [](std::int64_t value) { return value > -narrowLimit && value < narrowLimit; };
+        return fits(point.x) && fits(point.y) && fits(point.z);
+    }
+
+    constexpr explicit PointCloud3d(std::span<const Point> points)
+    {
+        x_.reserve(std::size(points));
+        y_.reserve(std::size(points));
+        z_.reserve(std::size(points));
+        for (const auto& point : points)
+        {
+            x_.push_back(point.x);
+            y_.push_back(point.y);
+            z_.push_back(point.z);
+            narrow_ = narrow_ && isNarrow(point);
+        }
+    }
+
+    constexpr std::size_t size() const { return std::size(x_); }
+    constexpr Point operator[](std::size_t i) const { return {x_[i], y_[i], z_[i]}; }
+    constexpr const std::int64_t* xs() const { return std::data(x_); }
+    constexpr const std::int64_t* ys() const { return std::data(y_); }
+    constexpr const std::int64_t* zs() const { return std::data(z_); }
+    constexpr bool narrow() const { return narrow_; }
+
+private:
+    std::vector<std::int64_t> x_;
+    std::vector<std::int64_t> y_;
+    std::vector<std::int64_t> z_;
+    bool narrow_ = true;
+};
+
+namespace detail
+{
+/**
+ * Vectorized prefix of the batched kernel, returns how many outputs it wrote.
+ */
+inline std::size_t euclideanDistanceSquareVectorized(const Point& point,
+                                                     const PointCloud3d& cloud,
+                                                     std::size_t first,
+                                                     std::span<std::int64_t> out)
+{
+    std::size_t k = 0;
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+    auto px = _mm512_set1_epi64(point.x);
+    auto py = _mm512_set1_epi64(point.y);
+    auto pz = _mm512_set1_epi64(point.z);
+    for (; k + 8 <= std::size(out); k += 8)
+    {
+        auto dx = _mm512_sub_epi64(_mm512_loadu_si512(cloud.xs() + first + k), px);
+        auto dy = _mm512_sub_epi64(_mm512_loadu_si512(cloud.ys() + first + k), py);
+        auto dz = _mm512_sub_epi64(_mm512_loadu_si512(cloud.zs() + first + k), pz);
+        auto sum = _mm512_add_epi64(
+            _mm512_add_epi64(_mm512_mullo_epi64(dx, dx), _mm512_mullo_epi64(dy, dy)),
+            _mm512_mullo_epi64(dz, dz));
+        _mm512_storeu_si512(std::data(out) + k, sum);
+    }
+#elif defined(__AVX2__)
+    // no 64-bit multiply, differences are squared as 32-bit values
+    if (not cloud.narrow() || not PointCloud3d::isNarrow(point))
+        return 0;
+
+    auto load = [&](const std::int64_t* data)
+    { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + first + k)); };
+    auto px = _mm256_set1_epi64x(point.x);
+    auto py = _mm256_set1_epi64x(point.y);
+    auto pz = _mm256_set1_epi64x(point.z);
+    for (; k + 4 <= std::size(out); k += 4)
+    {
+        auto dx = _mm256_sub_epi64(load(cloud.xs()), px);
+        auto dy = _mm256_sub_epi64(load(cloud.ys()), py);
+        auto dz = _mm256_sub_epi64(load(cloud.zs()), pz);
+        auto sum = _mm256_add_epi64(
+            _mm256_add_epi64(_mm256_mul_epi32(dx, dx), _mm256_mul_epi32(dy, dy)),
+            _mm256_mul_epi32(dz, dz));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(std::data(out) + k), sum);
+    }
+#endif
+    return k;
+}
+}  // namespace detail
+
+/**
+ * out[k] = squared distance between point and cloud[first + k].
+ * AVX-512/AVX2 at runtime, scalar in constant evaluated context and for the tail.
+ */
+constexpr void euclideanDistanceSquare(const Point& point,
+                                       const PointCloud3d& cloud,
+                                       std::size_t first,
+                                       std::span<std::int64_t> out)
+{
+    assert(first + std::size(out) <= std::size(cloud) && "block is out of the cloud");
+    std::size_t k = 0;
+    if (not std::is_constant_evaluated())
+        k = detail::euclideanDistanceSquareVectorized(point, cloud, first, out);
+    for (; k < std::size(out); ++k)
+        out[k] = euclideanDistanceSquare(point, cloud[first + k]);
+}
+
+static_assert(
+    []
+    {
+        std::vector<Point> points{{0, 0, 0}, {1, 1, 1}, {4, 5, 6}, {-1, 2, -3}};
+        PointCloud3d cloud{points};
+        std::vector<std::int64_t> out(3);
+        euclideanDistanceSquare({1, 2, 3}, cloud, 1, out);
+        return out == std::vector<std::int64_t>{5, 27, 40} && cloud.narrow();
+    }());
+}  // namespace aoc2025::geometry3d
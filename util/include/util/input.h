@@ -0,0 +1,206 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+
+namespace aoc2025::input
+{
+namespace detail
+{
+struct Unmap
+{
+    std::size_t size = 0;
+    void operator()(char* data) const { ::munmap(data, size); }
+};
+}  // namespace detail
+
+/**
+ * Reads a descriptor (file, pipe, stdin) to its end in fixed size pieces, passed to
+ * consume(std::string_view) one by one, so a stream never has to be held in memory.
+ * Returns false on a read error.
+ */
+template <typename F>
+bool readChunks(int fd, F&& consume)
+{
+    std::array<char, 1 << 16> chunk;
+    for (;;)
+    {
+        auto count = ::read(fd, std::data(chunk), std::size(chunk));
+        if (count < 0)
+            return false;
+        if (count == 0)
+            return true;
+        consume(std::string_view{std::data(chunk), static_cast<std::size_t>(count)});
+    }
+}
+
+/**
+ * Read-only content of a whole input file. Regular files are memory mapped,
+ * anything else (pipes, stdin) is read into memory.
+ */
+class InputFile
+{
+public:
+    static std::optional<InputFile> open(const std::filesystem::path& path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return std::nullopt;
+
+        auto result = fromDescriptor(fd);
+        ::close(fd);
+        return result;
+    }
+
+    static std::optional<InputFile> fromDescriptor(int fd)
+    {
+        InputFile result;
+        struct stat info{};
+        if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0)
+        {
+            auto size = static_cast<std::size_t>(info.st_size);
+            void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED)
+            {
+                ::madvise(data, size, MADV_SEQUENTIAL);
+                result.mapping_ = {static_cast<char*>(data), detail::Unmap{size}};
+                return result;
+            }
+        }
+
+        if (not readChunks(fd, [&](std::string_view chunk) { result.buffer_.append(chunk); }))
+            return std::nullopt;
+        return result;
+    }
+
+    std::string_view content() const
+    {
+        if (mapping_)
+            return {mapping_.get(), mapping_.get_deleter().size};
+        return buffer_;
+    }
+
+private:
+    InputFile() = default;
+
+    std::unique_ptr<char, detail::Unmap> mapping_;
+    std::string buffer_;
+};
+
+/**
+ * Lazy range of string_views into the content, splits lines (like std::getline,
+ * so a trailing newline does not produce an empty last line) or
+ * whitespace-separated tokens (like istream >> std::string).
+ */
+template <bool Tokens>
+class SplitView : public std::ranges::view_interface<SplitView<Tokens>>
+{
+public:
+    class Iterator
+    {
+    public:
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr Iterator() = default;
+        constexpr explicit Iterator(std::string_view rest)
+            : rest_(rest)
+        {
+            advance();
+        }
+
+        constexpr std::string_view operator*() const { return current_; }
+
+        constexpr Iterator& operator++()
+        {
+            advance();
+            return *this;
+        }
+
+        constexpr Iterator operator++(int)
+        {
+            auto copy = *this;
+            advance();
+            return copy;
+        }
+
+        constexpr bool operator==(std::default_sentinel_t) const { return done_; }
+        constexpr bool operator==(const Iterator& other) const
+        {
+            return done_ == other.done_
+                   && (done_ || std::data(current_) == std::data(other.current_));
+        }
+
+    private:
+        static constexpr std::string_view whitespace = " \t\r\n";
+
+        constexpr void advance()
+        {
+            if constexpr (Tokens)
+            {
+                rest_.remove_prefix(
+                    std::min(rest_.find_first_not_of(whitespace), std::size(rest_)));
+            }
+
+            if (std::empty(rest_))
+            {
+                done_ = true;
+                return;
+            }
+
+            auto end = Tokens ? rest_.find_first_of(whitespace) : rest_.find('\n');
+            current_ = rest_.substr(0, end);
+            rest_.remove_prefix(std::min(end, std::size(rest_) - 1) + 1);
+        }
+
+        std::string_view rest_;
+        std::string_view current_;
+        bool done_ = false;
+    };
+
+    constexpr SplitView() = default;
+    constexpr explicit SplitView(std::string_view content)
+        : content_(content)
+    {
+    }
+
+    constexpr Iterator begin() const { return Iterator{content_}; }
+    constexpr std::default_sentinel_t end() const { return {}; }
+
+private:
+    std::string_view content_;
+};
+
+constexpr auto lines(std::string_view content)
+{
+    return SplitView<false>{content};
+}
+
+constexpr auto tokens(std::string_view content)
+{
+    return SplitView<true>{content};
+}
+
+static_assert(std::ranges::forward_range<SplitView<false>>);
+static_assert(std::ranges::distance(lines("")) == 0);
+static_assert(std::ranges::distance(lines("a\nb\n")) == 2);
+static_assert(std::ranges::distance(lines("a\nb")) == 2);
+static_assert(std::ranges::equal(lines("ab\n\ncd"),
+                                 std::to_array<std::string_view>({"ab", "", "cd"})));
+static_assert(std::ranges::equal(tokens(" ab  c\nd \n"),
+                                 std::to_array<std::string_view>({"ab", "c", "d"})));
+
+}  // namespace aoc2025::input
@@ -0,0 +1,412 @@
+#pragma once
+
+#include "util/allocations.h"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace aoc2025::parallel
+{
+namespace detail
+{
+inline std::atomic<std::size_t> requestedThreads = 0;
+
+inline std::size_t defaultThreadCount()
+{
+    static const std::size_t count = []
+    {
+        std::size_t result = 0;
+        if (const char* env = std::getenv("AOC_THREADS"))
+            std::from_chars(env, env + std::strlen(env), result);
+        return result > 0 ? result : std::max(1u, std::thread::hardware_concurrency());
+    }();
+    return count;
+}
+}  // namespace detail
+
+/**
+ * Overrides the number of threads ($AOC_THREADS or hardware concurrency by default).
+ * Takes effect only before the first parallel loop creates the pool.
+ */
+inline void setThreadCount(std::size_t count)
+{
+    detail::requestedThreads = count;
+}
+
+/**
+ * Number of threads taking part in parallel loops (1 in constant evaluated context).
+ */
+constexpr std::size_t threadCount()
+{
+    if (std::is_constant_evaluated())
+        return 1;
+    if (auto requested = detail::requestedThreads.load(); requested > 0)
+        return requested;
+    return detail::defaultThreadCount();
+}
+
+/**
+ * Work stealing pool: every worker owns a deque, pops its own tasks LIFO and steals
+ * the oldest tasks of other workers when it runs dry. Tasks submitted from outside
+ * the pool are spread round robin.
+ */
+class ThreadPool
+{
+public:
+    using Task = std::function<void()>;
+
+    explicit ThreadPool(std::size_t threads)
+        : queues_(std::make_unique<Queue[]>(threads))
+        , size_(threads)
+    {
+        workers_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i)
+            workers_.emplace_back([this, i](std::stop_token stop) { work(stop, i); });
+    }
+
+    // The calling thread takes part in the work, so one worker less than threads
+    static ThreadPool& instance()
+    {
+        static ThreadPool pool{threadCount() - 1};
+        return pool;
+    }
+
+    std::size_t size() const { return size_; }
+
+    /**
+     * 1 + worker number on the pool's workers, 0 on any other thread.
+     */
+    static std::size_t currentIndex() { return currentPool_ ? currentWorker_ + 1 : 0; }
+
+    void submit(Task task)
+    {
+        auto queue = currentPool_ == this
+                         ? currentWorker_
+                         : nextQueue_.fetch_add(1, std::memory_order_relaxed) % size_;
+        {
+            // counted before a worker can pop it, so pending_ never drops below zero
+            std::lock_guard lock{queues_[queue].mutex};
+            pending_.fetch_add(1, std::memory_order_release);
+            queues_[queue].tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard lock{sleepMutex_};
+        }
+        wake_.notify_one();
+    }
+
+private:
+    struct alignas(64) Queue  // one cache line per queue head
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    static inline thread_local const ThreadPool* currentPool_ = nullptr;
+    static inline thread_local std::size_t currentWorker_ = 0;
+
+    std::optional<Task> pop(std::size_t self)
+    {
+        for (std::size_t offset = 0; offset < size_; ++offset)
+        {
+            auto& queue = queues_[(self + offset) % size_];
+            std::lock_guard lock{queue.mutex};
+            if (std::empty(queue.tasks))
+                continue;
+
+            auto own = offset == 0;
+            auto task = std::move(own ? queue.tasks.back() : queue.tasks.front());
+            own ? queue.tasks.pop_back() : queue.tasks.pop_front();
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            return task;
+        }
+        return std::nullopt;
+    }
+
+    void work(std::stop_token stop, std::size_t self)
+    {
+        currentPool_ = this;
+        currentWorker_ = self;
+        while (not stop.stop_requested())
+        {
+            if (auto task = pop(self))
+            {
+                (*task)();
+                continue;
+            }
+            std::unique_lock lock{sleepMutex_};
+            wake_.wait(
+                lock, stop, [this] { return pending_.load(std::memory_order_acquire) > 0; });
+        }
+    }
+
+    std::unique_ptr<Queue[]> queues_;
+    std::size_t size_ = 0;
+    std::atomic<std::size_t> nextQueue_ = 0;
+    std::atomic<std::size_t> pending_ = 0;
+    std::mutex sleepMutex_;
+    std::condition_variable_any wake_;
+    std::vector<std::jthread> workers_;  // last, so workers are joined first
+};
+
+namespace detail
+{
+/**
+ * Indices are claimed dynamically by the caller and helper tasks. Helpers that start
+ * late find nothing left and only hold the job alive; the caller sleeps until all indices
+ * are completed, not for helpers, and never runs foreign tasks, so nesting cannot
+ * deadlock.
+ */
+struct Job
+{
+    std::size_t count = 0;
+    std::function<void(std::size_t)> function;
+    std::atomic<std::size_t> next = 0;
+    std::atomic<std::size_t> done = 0;
+    memory::detail::Phase* phase = memory::detail::currentPhase;  // of the caller
+
+    void drain()
+    {
+        for (auto index = next++; index < count; index = next++)
+        {
+            {
+                // the caller waits for this index, so its phase is still alive
+                memory::detail::PhaseBinding binding{phase};
+                function(index);
+            }
+            if (done.fetch_add(1, std::memory_order_acq_rel) + 1 == count)
+                done.notify_all();
+        }
+    }
+
+    void wait()
+    {
+        for (auto finished = done.load(std::memory_order_acquire); finished < count;
+             finished = done.load(std::memory_order_acquire))
+            done.wait(finished, std::memory_order_acquire);
+    }
+};
+
+template <typename F>
+void runOnPool(std::size_t count, F& function)
+{
+    auto& pool = ThreadPool::instance();
+    auto job =
+        std::make_shared<Job>(count, [&function](std::size_t index) { function(index); });
+    for (auto helpers = std::min(pool.size(), count - 1); helpers > 0; --helpers)
+        pool.submit([job] { job->drain(); });
+
+    job->drain();
+    job->wait();
+}
+}  // namespace detail
+
+/**
+ * Calls function(index) for every index in [0, count) on the shared pool and waits
+ * for all of them. Runs sequentially in constant evaluated context.
+ */
+template <typename F>
+constexpr void forEachIndex(std::size_t count, F&& function)
+{
+    if (std::is_constant_evaluated() || count < 2 || threadCount() < 2)
+    {
+        for (std::size_t index = 0; index < count; ++index)
+            function(index);
+        return;
+    }
+    detail::runOnPool(count, function);
+}
+
+/**
+ * One lazily created value per thread of the pool (and the calling thread), for
+ * buffers reused across the items a worker processes. Only for use inside one loop.
+ */
+template <typename T>
+class WorkerLocal
+{
+public:
+    template <typename Make>
+    explicit WorkerLocal(Make make)
+        : make_(std::move(make))
+        , slots_(ThreadPool::instance().size() + 1)
+    {
+    }
+
+    T& local()
+    {
+        auto& slot = slots_[ThreadPool::currentIndex()];
+        if (not slot.value)
+            slot.value.emplace(make_());
+        return *slot.value;
+    }
+
+private:
+    struct alignas(64) Slot  // no false sharing between workers
+    {
+        std::optional<T> value;
+    };
+
+    std::function<T()> make_;
+    std::vector<Slot> slots_;
+};
+
+// Chunking depends only on the number of items, so reductions are combined in the
+// same order with any thread count and give reproducible results.
+constexpr std::size_t maxChunks = 256;
+
+constexpr std::pair<std::size_t, std::size_t> chunkBounds(std::size_t size,
+                                                          std::size_t chunks,
+                                                          std::size_t chunk)
+{
+    return {size * chunk / chunks, size * (chunk + 1) / chunks};
+}
+static_assert(chunkBounds(10, 3, 0) == std::pair<std::size_t, std::size_t>{0, 3});
+static_assert(chunkBounds(10, 3, 2) == std::pair<std::size_t, std::size_t>{6, 10});
+
+/**
+ * Calls function(item, scratch) for every item of a random access range, scratch is
+ * created by makeScratch() at most once per thread.
+ */
+template <std::ranges::random_access_range R, std::invocable MakeScratch, typename F>
+    requires std::ranges::sized_range<R>
+constexpr void parallelFor(R&& items, MakeScratch makeScratch, F&& function)
+{
+    using Scratch = std::invoke_result_t<MakeScratch&>;
+    auto size = static_cast<std::size_t>(std::ranges::size(items));
+    if (std::is_constant_evaluated() || threadCount() < 2)
+    {
+        auto scratch = makeScratch();
+        for (auto&& item : items)
+            function(item, scratch);
+        return;
+    }
+
+    using Difference = std::ranges::range_difference_t<R>;
+    WorkerLocal<Scratch> scratch{std::move(makeScratch)};
+    auto chunks = std::min(size, maxChunks);
+    forEachIndex(  //
+        chunks,
+        [&](std::size_t chunk)
+        {
+            auto first = std::ranges::begin(items);
+            auto& local = scratch.local();
+            for (auto [begin, end] = chunkBounds(size, chunks, chunk); begin < end; ++begin)
+                function(first[static_cast<Difference>(begin)], local);
+        });
+}
+
+template <std::ranges::random_access_range R, typename F>
+    requires std::ranges::sized_range<R>
+constexpr void parallelFor(R&& items, F&& function)
+{
+    parallelFor(
+        std::forward<R>(items),
+        [] { return std::monostate{}; },
+        [&](auto&& item, std::monostate) { function(std::forward<decltype(item)>(item)); });
+}
+
+/**
+ * reduce(init, transform(item, scratch)...) over a random access range. Contiguous
+ * chunks are reduced in parallel and combined left to right, `reduce` has to be
+ * associative but not commutative. Sequential fold in constant evaluated context.
+ */
+template <std::ranges::random_access_range R,
+          typename T,
+          typename Reduce,
+          std::invocable MakeScratch,
+          typename Transform>
+    requires std::ranges::sized_range<R>
+constexpr T parallelTransformReduce(
+    R&& items, T init, Reduce reduce, MakeScratch makeScratch, Transform transform)
+{
+    auto size = static_cast<std::size_t>(std::ranges::size(items));
+    if (std::is_constant_evaluated() || threadCount() < 2 || size < 2)
+    {
+        auto scratch = makeScratch();
+        for (auto&& item : items)
+            init = reduce(std::move(init), std::invoke(transform, item, scratch));
+        return init;
+    }
+
+    using Scratch = std::invoke_result_t<MakeScratch&>;
+    using Difference = std::ranges::range_difference_t<R>;
+    WorkerLocal<Scratch> scratch{std::move(makeScratch)};
+    auto chunks = std::min(size, maxChunks);
+    std::vector<std::optional<T>> partial(chunks);
+    forEachIndex(  //
+        chunks,
+        [&](std::size_t chunk)
+        {
+            auto first = std::ranges::begin(items);
+            auto& local = scratch.local();
+            std::optional<T> result;
+            for (auto [begin, end] = chunkBounds(size, chunks, chunk); begin < end; ++begin)
+            {
+                T value = std::invoke(transform, first[static_cast<Difference>(begin)], local);
+                result = result ? T(reduce(std::move(*result), std::move(value)))
+                                : std::move(value);
+            }
+            partial[chunk] = std::move(result);
+        });
+
+    for (auto& value : partial)
+        init = reduce(std::move(init), std::move(*value));
+    return init;
+}
+
+template <std::ranges::random_access_range R, typename T, typename Reduce, typename Transform>
+    requires std::ranges::sized_range<R>
+constexpr T parallelTransformReduce(R&& items, T init, Reduce reduce, Transform transform)
+{
+    return parallelTransformReduce(
+        std::forward<R>(items),
+        std::move(init),
+        std::move(reduce),
+        [] { return std::monostate{}; },
+        [&](auto&& item, std::monostate)
+        { return std::invoke(transform, std::forward<decltype(item)>(item)); });
+}
+
+static_assert(parallelTransformReduce(  //
+                  std::views::iota(1, 5),
+                  std::vector<int>{},
+                  [](std::vector<int> lhs, const std::vector<int>& rhs)
+                  {
+                      lhs.insert(std::end(lhs), std::begin(rhs), std::end(rhs));
+                      return lhs;
+                  },
+                  [](int value) { return std::vector{value}; })
+              == std::vector{1, 2, 3, 4});
+static_assert(
+    []
+    {
+        int total = 0;
+        parallelFor(
+            std::views::iota(0, 4),
+            [] { return std::vector<int>{}; },
+            [&](int value, std::vector<int>& buffer)
+            {
+                buffer.push_back(value);
+                total += std::ssize(buffer);
+            });
+        return total == 1 + 2 + 3 + 4;
+    }());
+
+}  // namespace aoc2025::parallel
@@ -0,0 +1,273 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace aoc2025::parse
+{
+namespace detail
+{
+constexpr bool isDigit(char ch)
+{
+    return static_cast<unsigned char>(ch - '0') < 10;
+}
+
+/**
+ * A number is negative if it directly follows the negative prefix. A '-' that
+ * follows a digit is a separator, so "11-22" is a range and not 11 and -22.
+ */
+template <std::integral T>
+constexpr bool isNegative(std::string_view text, std::size_t start, char negativePrefix)
+{
+    if constexpr (std::is_unsigned_v<T>)
+        return false;
+    else
+    {
+        return start > 0 && text[start - 1] == negativePrefix
+               && (negativePrefix != '-' || start == 1 || not isDigit(text[start - 2]));
+    }
+}
+
+template <std::integral T>
+constexpr T accumulateDigits(const char* digits, std::size_t length)
+{
+    T value = 0;
+    for (std::size_t i = 0; i < length; ++i)
+        value = value * 10 + (digits[i] - '0');
+    return value;
+}
+
+template <std::integral T>
+constexpr T withSign(T value, bool negative)
+{
+    return negative ? static_cast<T>(-value) : value;
+}
+
+template <std::integral T>
+constexpr std::size_t parseScalar(std::string_view text,
+                                  std::span<T> output,
+                                  char negativePrefix,
+                                  std::size_t pos = 0)
+{
+    std::size_t count = 0;
+    while (count < std::size(output))
+    {
+        while (pos < std::size(text) && not isDigit(text[pos]))
+            ++pos;
+        if (pos == std::size(text))
+            break;
+
+        auto start = pos;
+        while (pos < std::size(text) && isDigit(text[pos]))
+            ++pos;
+        output[count++] = withSign(accumulateDigits<T>(std::data(text) + start, pos - start),
+                                   isNegative<T>(text, start, negativePrefix));
+    }
+    return count;
+}
+
+constexpr std::size_t countScalar(std::string_view text, std::size_t pos = 0)
+{
+    std::size_t count = 0;
+    for (bool previous = false; pos < std::size(text); ++pos)
+    {
+        bool current = isDigit(text[pos]);
+        count += current && not previous;
+        previous = current;
+    }
+    return count;
+}
+
+/**
+ * Bit i is set if data[i] is a digit, reads exactly 64 bytes.
+ */
+inline std::uint64_t digitMask(const char* data)
+{
+#if defined(__AVX2__)
+    auto classify = [](const char* chunk)
+    {
+        auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chunk));
+        auto shifted = _mm256_sub_epi8(bytes, _mm256_set1_epi8('0'));
+        auto digits =
+            _mm256_cmpeq_epi8(_mm256_min_epu8(shifted, _mm256_set1_epi8(9)), shifted);
+        return std::uint64_t{static_cast<std::uint32_t>(_mm256_movemask_epi8(digits))};
+    };
+    return classify(data) | classify(data + 32) << 32;
+#elif defined(__SSE2__)
+    auto classify = [](const char* chunk)
+    {
+        auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chunk));
+        auto shifted = _mm_sub_epi8(bytes, _mm_set1_epi8('0'));
+        auto digits = _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(9)), shifted);
+        return std::uint64_t{static_cast<std::uint16_t>(_mm_movemask_epi8(digits))};
+    };
+    return classify(data) | classify(data + 16) << 16 | classify(data + 32) << 32
+           | classify(data + 48) << 48;
+#else
+    std::uint64_t mask = 0;
+    for (int i = 0; i < 64; ++i)
+        mask |= std::uint64_t{isDigit(data[i])} << i;
+    return mask;
+#endif
+}
+
+/**
+ * Loads `length` (1..8) digits right-aligned into a word padded with '0'.
+ * Reads 8 bytes, bytes past the digits are shifted out.
+ */
+inline std::uint64_t loadDigits(const char* data, std::size_t length)
+{
+    std::uint64_t chunk;
+    std::memcpy(&chunk, data, sizeof(chunk));
+    auto padding = (8 - length) * 8;
+    return (chunk << padding) | (0x3030303030303030ull & ((std::uint64_t{1} << padding) - 1));
+}
+
+/**
+ * SWAR conversion of eight ASCII digits (first digit in the lowest byte).
+ */
+inline std::uint64_t parseEightDigits(std::uint64_t chunk)
+{
+    constexpr std::uint64_t mask = 0x000000FF000000FF;
+    constexpr std::uint64_t mul1 = 100 + (1000000ull << 32);
+    constexpr std::uint64_t mul2 = 1 + (10000ull << 32);
+    chunk -= 0x3030303030303030;
+    chunk = chunk * 10 + (chunk >> 8);
+    return (((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32;
+}
+
+template <std::integral T>
+T parseDigits(std::string_view text, std::size_t start, std::size_t end)
+{
+    const char* digits = std::data(text) + start;
+    auto length = end - start;
+    if (start + 8 > std::size(text))  // not enough bytes for a word load
+        return accumulateDigits<T>(digits, length);
+
+    auto head = length % 8 == 0 ? 8 : length % 8;
+    auto value = static_cast<T>(parseEightDigits(loadDigits(digits, head)));
+    for (auto i = head; i < length; i += 8)
+        value = value * 100000000 + static_cast<T>(parseEightDigits(loadDigits(digits + i, 8)));
+    return value;
+}
+
+/**
+ * Classifies 64 bytes at a time and walks the starts of digit runs with bit tricks,
+ * the remaining tail is handled by the scalar parser.
+ */
+template <std::integral T>
+std::size_t parseVectorized(std::string_view text, std::span<T> output, char negativePrefix)
+{
+    const char* data = std::data(text);
+    std::size_t count = 0;
+    std::size_t pos = 0;
+    std::uint64_t continued = 0;  // the previous block ended inside a number
+    for (; pos + 64 <= std::size(text) && count < std::size(output); pos += 64)
+    {
+        auto digits = digitMask(data + pos);
+        auto starts = digits & ~(digits << 1 | continued);
+        continued = digits >> 63;
+        for (; starts != 0 && count < std::size(output); starts &= starts - 1)
+        {
+            auto offset = std::countr_zero(starts);
+            auto start = pos + offset;
+            auto end = start;
+            if (auto rest = ~digits >> offset; rest != 0)
+                end += std::countr_zero(rest);
+            else
+            {
+                for (end = pos + 64; end < std::size(text) && isDigit(data[end]); ++end)
+                {
+                }
+            }
+            output[count++] = withSign(parseDigits<T>(text, start, end),
+                                       isNegative<T>(text, start, negativePrefix));
+        }
+    }
+
+    if (count == std::size(output))
+        return count;
+    for (; continued && pos < std::size(text) && isDigit(data[pos]); ++pos)
+    {
+    }
+    return count + parseScalar(text, output.subspan(count), negativePrefix, pos);
+}
+
+inline std::size_t countVectorized(std::string_view text)
+{
+    std::size_t count = 0;
+    std::size_t pos = 0;
+    std::uint64_t continued = 0;
+    for (; pos + 64 <= std::size(text); pos += 64)
+    {
+        auto digits = digitMask(std::data(text) + pos);
+        count += std::popcount(digits & ~(digits << 1 | continued));
+        continued = digits >> 63;
+    }
+    for (; continued && pos < std::size(text) && isDigit(text[pos]); ++pos)
+    {
+    }
+    return count + countScalar(text, pos);
+}
+}  // namespace detail
+
+/**
+ * Parses every integer in `text` into `output` and returns how many were written.
+ * Anything that is not a digit separates numbers (",", " ", "-", "x", "\n", prefixes
+ * like "L"/"R"); for signed types a number directly after `negativePrefix` is negated.
+ * Vectorized at runtime, scalar in constant evaluated context.
+ */
+template <std::integral T>
+constexpr std::size_t parseIntegers(std::string_view text,
+                                    std::span<T> output,
+                                    char negativePrefix = '-')
+{
+    if (std::is_constant_evaluated() || std::endian::native != std::endian::little)
+        return detail::parseScalar(text, output, negativePrefix);
+    return detail::parseVectorized(text, output, negativePrefix);
+}
+
+constexpr std::size_t countIntegers(std::string_view text)
+{
+    if (std::is_constant_evaluated())
+        return detail::countScalar(text);
+    return detail::countVectorized(text);
+}
+
+template <std::integral T>
+constexpr std::vector<T> parseIntegers(std::string_view text, char negativePrefix = '-')
+{
+    std::vector<T> result(countIntegers(text));
+    parseIntegers(text, std::span{result}, negativePrefix);
+    return result;
+}
+
+static_assert(countIntegers("") == 0);
+static_assert(countIntegers("41x48: 29 35 26 36 38 44") == 8);
+static_assert(parseIntegers<std::int64_t>("11-22,95-115")
+              == std::vector<std::int64_t>{11, 22, 95, 115});
+static_assert(parseIntegers<int>("L68\nR48\nL5\n", 'L') == std::vector{-68, 48, -5});
+static_assert(parseIntegers<int>("-5, 3 -7,-0") == std::vector{-5, 3, -7, 0});
+static_assert(parseIntegers<unsigned>("-5 {3,5,4,7}") == std::vector<unsigned>{5, 3, 5, 4, 7});
+static_assert(parseIntegers<std::int64_t>("1234567890123456789")
+              == std::vector<std::int64_t>{1234567890123456789});
+static_assert(
+    []
+    {
+        std::array<int, 2> output{};
+        auto count = parseIntegers<int>("(0,2) (3)", output);
+        return count == 2 && output == std::array{0, 2};
+    }());
+
+}  // namespace aoc2025::parse
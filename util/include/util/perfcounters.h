@@ -0,0 +1,158 @@
+#pragma once
+
+#include "util/smallvector.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+namespace aoc2025::time
+{
+/**
+ * Hardware events counted since a PerfCounters was created. Events the machine (or
+ * the container) does not provide stay empty.
+ */
+struct CounterValues
+{
+    std::optional<std::uint64_t> cycles;
+    std::optional<std::uint64_t> instructions;
+    std::optional<std::uint64_t> l1dMisses;  // L1 data cache read misses
+    std::optional<std::uint64_t> llcMisses;  // last level cache read misses
+    std::optional<std::uint64_t> branchMisses;
+
+    std::optional<double> ipc() const
+    {
+        if (not cycles || not instructions || *cycles == 0)
+            return std::nullopt;
+        return static_cast<double>(*instructions) / static_cast<double>(*cycles);
+    }
+};
+
+/**
+ * A Stopwatch for hardware events: a perf_event_open group of cycles, instructions,
+ * cache and branch misses is started on creation and elapsed() reads the counts since
+ * then. Only the calling thread is counted (user space). Where perf events are not
+ * available (other OS, perf_event_paranoid, seccomp in containers) available() is
+ * false and elapsed() returns empty values.
+ */
+class PerfCounters
+{
+public:
+    PerfCounters()
+    {
+#if defined(__linux__)
+        for (std::size_t i = 0; i < std::size(events); ++i)
+        {
+            auto group = std::empty(opened_) ? -1 : opened_.front().fd;
+            if (auto fd = open(events[i], group); fd >= 0)
+                opened_.push_back({fd, i});
+            else if (std::empty(opened_))
+                return;  // without the group leader (cycles) nothing can be counted
+        }
+        ::ioctl(opened_.front().fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ::ioctl(opened_.front().fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    ~PerfCounters()
+    {
+#if defined(__linux__)
+        for (const auto& counter : opened_)
+            ::close(counter.fd);
+#endif
+    }
+
+    bool available() const { return not std::empty(opened_); }
+
+    /**
+     * Counts since creation, scaled up if the kernel had to multiplex the group.
+     */
+    CounterValues elapsed() const
+    {
+        CounterValues result;
+#if defined(__linux__)
+        if (not available())
+            return result;
+
+        // PERF_FORMAT_GROUP: nr, time enabled, time running, one value per counter
+        std::array<std::uint64_t, 3 + std::size(events)> data{};
+        auto bytes = ::read(opened_.front().fd, std::data(data), sizeof(data));
+        if (bytes < static_cast<ssize_t>(3 * sizeof(std::uint64_t)) || data[2] == 0)
+            return result;
+
+        auto scale = static_cast<double>(data[1]) / static_cast<double>(data[2]);
+        std::array<std::optional<std::uint64_t>*, std::size(events)> fields{
+            &result.cycles,
+            &result.instructions,
+            &result.l1dMisses,
+            &result.llcMisses,
+            &result.branchMisses,
+        };
+        for (std::size_t i = 0; i < std::size(opened_) && i < data[0]; ++i)
+        {
+            *fields[opened_[i].event] =
+                static_cast<std::uint64_t>(static_cast<double>(data[3 + i]) * scale);
+        }
+#endif
+        return result;
+    }
+
+private:
+#if defined(__linux__)
+    struct Event
+    {
+        std::uint32_t type;
+        std::uint64_t config;
+    };
+
+    // in the order of CounterValues, cycles is the group leader
+    static constexpr std::array<Event, 5> events{{
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HW_CACHE,
+         PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+             | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+        {PERF_TYPE_HW_CACHE,
+         PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+             | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    }};
+
+    static int open(const Event& event, int group)
+    {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = event.type;
+        attr.config = event.config;
+        attr.disabled = group == -1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED
+                           | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, group, 0));
+    }
+#else
+    static constexpr std::array<int, 5> events{};
+#endif
+
+    struct Counter
+    {
+        int fd = -1;
+        std::size_t event = 0;
+    };
+
+    containers::InplaceVector<Counter, std::size(events)> opened_;
+};
+}  // namespace aoc2025::time
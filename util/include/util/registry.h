@@ -0,0 +1,75 @@
+#pragma once
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <concepts>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace aoc2025::registry
+{
+/**
+ * One part of a day bound to already parsed input.
+ * `solve` runs the solver and returns the formatted answer.
+ */
+struct Part
+{
+    int number = 0;
+    std::function<std::string()> solve;
+};
+
+/**
+ * Entry point of a day's solution.
+ * `load` parses the raw input and returns parts bound to the parsed data,
+ * so parse and solve time can be measured separately. Parsed data may keep views
+ * into the content, so the content has to outlive the parts.
+ */
+struct Solution
+{
+    std::string name;  // matches the executable name, e.g. "day10-2"
+    int day = 0;
+    std::function<std::vector<Part>(std::string_view)> load;
+    // Optional check of code only reached at run time (SIMD kernels the static_asserts
+    // cannot evaluate) against its reference, false on a mismatch
+    std::function<bool()> selfCheck;
+    // Optional comparison of the answers with a slower reference solver on the same input,
+    // run by `aoc --cross-check`; false on a mismatch
+    std::function<bool(std::string_view)> crossCheck;
+};
+
+inline std::vector<Solution>& solutions()
+{
+    static std::vector<Solution> registered;
+    return registered;
+}
+
+/**
+ * Registers a solution during static initialization. Solutions are built as
+ * object libraries, so the registrar is never dropped by the linker.
+ */
+struct Registrar
+{
+    explicit Registrar(Solution solution)
+    {
+        solutions().push_back(std::move(solution));
+    }
+};
+
+inline std::vector<Solution> sortedSolutions()
+{
+    auto result = solutions();
+    std::ranges::sort(result, std::less{}, &Solution::name);
+    return result;
+}
+
+template <std::invocable F>
+Part makePart(int number, F solver)
+{
+    return {number, [solver = std::move(solver)] { return fmt::format("{}", solver()); }};
+}
+
+}  // namespace aoc2025::registry
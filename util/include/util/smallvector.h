@@ -0,0 +1,289 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace aoc2025::containers
+{
+/**
+ * Vector with inline storage for at most N elements, usable in constant evaluation.
+ * Elements live in a std::array, so T has to be default constructible; slots past
+ * size() hold default constructed values.
+ */
+template <typename T, std::size_t N>
+class InplaceVector
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr InplaceVector() = default;
+    constexpr explicit InplaceVector(size_type count, const T& value = T{})
+    {
+        resize(count, value);
+    }
+    constexpr InplaceVector(std::initializer_list<T> values)
+        : InplaceVector(std::begin(values), std::end(values))
+    {
+    }
+    template <std::input_iterator It, std::sentinel_for<It> S>
+    constexpr InplaceVector(It first, S last)
+    {
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    static constexpr size_type capacity() { return N; }
+    static constexpr size_type max_size() { return N; }
+    constexpr size_type size() const { return size_; }
+    constexpr bool empty() const { return size_ == 0; }
+
+    constexpr T* data() { return std::data(elements_); }
+    constexpr const T* data() const { return std::data(elements_); }
+    constexpr iterator begin() { return data(); }
+    constexpr iterator end() { return data() + size_; }
+    constexpr const_iterator begin() const { return data(); }
+    constexpr const_iterator end() const { return data() + size_; }
+
+    constexpr T& operator[](size_type index)
+    {
+        assert(index < size_ && "index out of range");
+        return elements_[index];
+    }
+    constexpr const T& operator[](size_type index) const
+    {
+        assert(index < size_ && "index out of range");
+        return elements_[index];
+    }
+    constexpr T& front() { return (*this)[0]; }
+    constexpr const T& front() const { return (*this)[0]; }
+    constexpr T& back() { return (*this)[size_ - 1]; }
+    constexpr const T& back() const { return (*this)[size_ - 1]; }
+
+    constexpr void reserve(size_type count) const
+    {
+        assert(count <= N && "InplaceVector capacity exceeded");
+    }
+
+    template <typename... Args>
+    constexpr T& emplace_back(Args&&... args)
+    {
+        assert(size_ < N && "InplaceVector capacity exceeded");
+        elements_[size_] = T(std::forward<Args>(args)...);
+        return elements_[size_++];
+    }
+    constexpr void push_back(const T& value) { emplace_back(value); }
+    constexpr void push_back(T&& value) { emplace_back(std::move(value)); }
+    constexpr void pop_back()
+    {
+        assert(size_ > 0 && "pop_back on empty InplaceVector");
+        elements_[--size_] = T{};
+    }
+
+    constexpr void resize(size_type count, const T& value = T{})
+    {
+        assert(count <= N && "InplaceVector capacity exceeded");
+        for (; size_ < count; ++size_)
+            elements_[size_] = value;
+        while (size_ > count)
+            pop_back();
+    }
+    constexpr void clear() { resize(0); }
+
+    constexpr iterator erase(const_iterator first, const_iterator last)
+    {
+        auto target = begin() + (first - begin());
+        auto newEnd = std::move(target + (last - first), end(), target);
+        resize(static_cast<size_type>(newEnd - begin()));
+        return target;
+    }
+
+    friend constexpr bool operator==(const InplaceVector& lhs, const InplaceVector& rhs)
+    {
+        return std::ranges::equal(lhs, rhs);
+    }
+
+private:
+    std::array<T, N> elements_{};
+    size_type size_ = 0;
+};
+
+/**
+ * Vector that keeps up to N elements inline and moves them to the heap once it grows
+ * beyond that, so there is no hard limit. Usable in constant evaluation.
+ */
+template <typename T, std::size_t N>
+class SmallVector
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr SmallVector() = default;
+    constexpr explicit SmallVector(size_type count, const T& value = T{})
+    {
+        resize(count, value);
+    }
+    constexpr SmallVector(std::initializer_list<T> values)
+        : SmallVector(std::begin(values), std::end(values))
+    {
+    }
+    template <std::input_iterator It, std::sentinel_for<It> S>
+    constexpr SmallVector(It first, S last)
+    {
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    constexpr size_type capacity() const { return onHeap_ ? heap_.capacity() : N; }
+    constexpr size_type max_size() const { return heap_.max_size(); }
+    constexpr size_type size() const { return onHeap_ ? std::size(heap_) : std::size(inline_); }
+    constexpr bool empty() const { return size() == 0; }
+    constexpr bool onHeap() const { return onHeap_; }
+
+    constexpr T* data() { return onHeap_ ? std::data(heap_) : std::data(inline_); }
+    constexpr const T* data() const { return onHeap_ ? std::data(heap_) : std::data(inline_); }
+    constexpr iterator begin() { return data(); }
+    constexpr iterator end() { return data() + size(); }
+    constexpr const_iterator begin() const { return data(); }
+    constexpr const_iterator end() const { return data() + size(); }
+
+    constexpr T& operator[](size_type index)
+    {
+        assert(index < size() && "index out of range");
+        return data()[index];
+    }
+    constexpr const T& operator[](size_type index) const
+    {
+        assert(index < size() && "index out of range");
+        return data()[index];
+    }
+    constexpr T& front() { return (*this)[0]; }
+    constexpr const T& front() const { return (*this)[0]; }
+    constexpr T& back() { return (*this)[size() - 1]; }
+    constexpr const T& back() const { return (*this)[size() - 1]; }
+
+    constexpr void reserve(size_type count)
+    {
+        if (count > capacity())
+            spill(count);
+    }
+
+    template <typename... Args>
+    constexpr T& emplace_back(Args&&... args)
+    {
+        if (not onHeap_ && std::size(inline_) == N)
+        {
+            // the arguments may refer to elements, so build the new one before they move
+            T value(std::forward<Args>(args)...);
+            spill(2 * N + 1);
+            return heap_.emplace_back(std::move(value));
+        }
+        if (onHeap_)
+            return heap_.emplace_back(std::forward<Args>(args)...);
+        return inline_.emplace_back(std::forward<Args>(args)...);
+    }
+    constexpr void push_back(const T& value) { emplace_back(value); }
+    constexpr void push_back(T&& value) { emplace_back(std::move(value)); }
+    constexpr void pop_back() { onHeap_ ? heap_.pop_back() : inline_.pop_back(); }
+
+    constexpr void resize(size_type count, const T& value = T{})
+    {
+        if (count > capacity())
+        {
+            T copy = value;  // value may be one of the elements spill() moves
+            spill(count);
+            heap_.resize(count, copy);
+            return;
+        }
+        onHeap_ ? heap_.resize(count, value) : inline_.resize(count, value);
+    }
+    constexpr void clear() { onHeap_ ? heap_.clear() : inline_.clear(); }
+
+    constexpr iterator erase(const_iterator first, const_iterator last)
+    {
+        auto offset = first - begin();
+        auto count = last - first;
+        if (onHeap_)
+            heap_.erase(std::begin(heap_) + offset, std::begin(heap_) + offset + count);
+        else
+            inline_.erase(std::begin(inline_) + offset, std::begin(inline_) + offset + count);
+        return begin() + offset;
+    }
+
+    friend constexpr bool operator==(const SmallVector& lhs, const SmallVector& rhs)
+    {
+        return std::ranges::equal(lhs, rhs);
+    }
+
+private:
+    constexpr void spill(size_type capacity)
+    {
+        std::vector<T> heap;
+        heap.reserve(std::max(capacity, size()));
+        std::ranges::move(*this, std::back_inserter(heap));
+        inline_.clear();
+        heap_ = std::move(heap);
+        onHeap_ = true;
+    }
+
+    InplaceVector<T, N> inline_;
+    std::vector<T> heap_;
+    bool onHeap_ = false;
+};
+
+static_assert(std::ranges::contiguous_range<InplaceVector<int, 4>>);
+static_assert(std::ranges::contiguous_range<SmallVector<int, 4>>);
+static_assert(
+    []
+    {
+        InplaceVector<int, 4> values{1, 2, 3, 4};
+        values.erase(std::begin(values) + 1, std::begin(values) + 3);
+        values.push_back(5);
+        return values == InplaceVector<int, 4>{1, 4, 5};
+    }());
+static_assert(
+    []
+    {
+        SmallVector<int, 2> values{1, 2};
+        auto inlineBefore = not values.onHeap();
+        values.push_back(3);
+        values.resize(5, 7);
+        return inlineBefore && values.onHeap() && values == SmallVector<int, 2>{1, 2, 3, 7, 7};
+    }());
+static_assert(
+    []
+    {
+        // arguments that alias an element at the inline-to-heap boundary
+        SmallVector<int, 2> pushed{5, 6};
+        pushed.push_back(pushed[0]);
+        SmallVector<int, 2> resized{5};
+        resized.resize(4, resized[0]);
+        return pushed == SmallVector<int, 2>{5, 6, 5}
+               && resized == SmallVector<int, 2>{5, 5, 5, 5};
+    }());
+static_assert(
+    []
+    {
+        auto values = std::views::iota(0, 10) | std::ranges::to<SmallVector<int, 4>>();
+        values.erase(std::begin(values), std::begin(values) + 8);
+        return values == SmallVector<int, 4>{8, 9};
+    }());
+}  // namespace aoc2025::containers
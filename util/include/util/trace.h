@@ -2,6 +2,16 @@
 
 #include <fmt/format.h>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
 namespace aoc2025::diagnostic
 {
 /**
@@ -21,4 +31,212 @@ consteval auto makeTracer()
     };
 }
 
+/**
+ * A recorded span ('X') or counter sample ('C'); times are in nanoseconds since
+ * the first recorded event. Names must have static storage duration (literals).
+ */
+struct TraceEvent
+{
+    std::string_view name;
+    std::int64_t timestamp = 0;
+    std::int64_t value = 0;  // duration of a span, value of a counter
+    char phase = 'X';
+};
+
+/**
+ * Single producer ring buffer owned by one thread, keeps the latest Capacity events.
+ * Only the owner writes, readers are expected to run after the owner is done.
+ */
+template <std::size_t Capacity>
+class TraceRingBuffer
+{
+public:
+    void push(const TraceEvent& event)
+    {
+        auto written = written_.load(std::memory_order_relaxed);
+        events_[written % Capacity] = event;
+        written_.store(written + 1, std::memory_order_release);
+    }
+
+    void forEach(auto function) const
+    {
+        auto written = written_.load(std::memory_order_acquire);
+        for (auto i = written > Capacity ? written - Capacity : 0; i < written; ++i)
+            function(events_[i % Capacity]);
+    }
+
+private:
+    std::array<TraceEvent, Capacity> events_{};
+    std::atomic<std::uint64_t> written_ = 0;
+};
+
+/**
+ * Owns per-thread buffers and writes them as Chrome/Perfetto trace JSON on exit
+ * to $AOC_TRACE_FILE (trace.json by default).
+ */
+class TraceCollector
+{
+public:
+    static constexpr std::size_t bufferCapacity = 1 << 16;
+
+    static TraceCollector& instance()
+    {
+        static TraceCollector collector;
+        return collector;
+    }
+
+    void record(const TraceEvent& event)
+    {
+        thread_local ThreadBuffer* buffer = registerThread();
+        buffer->events.push(event);
+    }
+
+    std::int64_t now() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch_)
+            .count();
+    }
+
+    TraceCollector(const TraceCollector&) = delete;
+    TraceCollector& operator=(const TraceCollector&) = delete;
+
+    ~TraceCollector()
+    {
+        const char* path = std::getenv("AOC_TRACE_FILE");
+        if (std::FILE* file = std::fopen(path ? path : "trace.json", "w"))
+        {
+            write(file);
+            std::fclose(file);
+        }
+        for (auto* buffer = head_.load(); buffer;)
+            delete std::exchange(buffer, buffer->next);
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct ThreadBuffer
+    {
+        int threadId = 0;
+        ThreadBuffer* next = nullptr;
+        TraceRingBuffer<bufferCapacity> events;
+    };
+
+    TraceCollector() = default;
+
+    // Buffers are pushed into a lock-free list and outlive their threads.
+    ThreadBuffer* registerThread()
+    {
+        auto* buffer = new ThreadBuffer{.threadId = nextThreadId_++};
+        buffer->next = head_.load(std::memory_order_relaxed);
+        while (not head_.compare_exchange_weak(
+            buffer->next, buffer, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+        return buffer;
+    }
+
+    void write(std::FILE* file) const
+    {
+        fmt::print(file, "{{\"displayTimeUnit\": \"ns\", \"traceEvents\": [");
+        auto separator = "";
+        for (auto* buffer = head_.load(std::memory_order_acquire); buffer;
+             buffer = buffer->next)
+        {
+            buffer->events.forEach(
+                [&](const TraceEvent& event)
+                {
+                    fmt::print(file,
+                               "{}\n{{\"name\": \"{}\", \"ph\": \"{}\", \"pid\": 1, "
+                               "\"tid\": {}, \"ts\": {:.3f}",
+                               std::exchange(separator, ","),
+                               event.name,
+                               event.phase,
+                               buffer->threadId,
+                               event.timestamp / 1000.0);
+                    if (event.phase == 'X')
+                        fmt::print(file, ", \"dur\": {:.3f}}}", event.value / 1000.0);
+                    else
+                        fmt::print(file, ", \"args\": {{\"value\": {}}}}}", event.value);
+                });
+        }
+        fmt::print(file, "\n]}}\n");
+    }
+
+    Clock::time_point epoch_ = Clock::now();
+    std::atomic<ThreadBuffer*> head_ = nullptr;
+    std::atomic<int> nextThreadId_ = 0;
+};
+
+/**
+ * RAII span, records its lifetime when enabled. Does nothing in constant
+ * evaluated context, so it can be used inside constexpr solvers.
+ */
+template <bool Enabled>
+class ScopedSpan
+{
+public:
+    constexpr explicit ScopedSpan(std::string_view name)
+        : name_(name)
+    {
+        if constexpr (Enabled)
+        {
+            if (not std::is_constant_evaluated())
+                start_ = TraceCollector::instance().now();
+        }
+    }
+
+    constexpr ~ScopedSpan()
+    {
+        if constexpr (Enabled)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                auto& collector = TraceCollector::instance();
+                collector.record({name_, start_, collector.now() - start_, 'X'});
+            }
+        }
+    }
+
+    ScopedSpan(const ScopedSpan&) = delete;
+    ScopedSpan& operator=(const ScopedSpan&) = delete;
+
+private:
+    std::string_view name_;
+    std::int64_t start_ = 0;
+};
+
+template <bool Enabled>
+struct Profiler
+{
+    [[nodiscard]] constexpr ScopedSpan<Enabled> span(std::string_view name) const
+    {
+        return ScopedSpan<Enabled>{name};
+    }
+
+    constexpr void counter(std::string_view name, std::int64_t value) const
+    {
+        if constexpr (Enabled)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                auto& collector = TraceCollector::instance();
+                collector.record({name, collector.now(), value, 'C'});
+            }
+        }
+    }
+};
+
+/**
+ * Spans and counters for hot paths, compiled out when disabled:
+ *  constexpr auto profiler = diagnostic::makeProfiler<true>();
+ *  auto span = profiler.span("elimination");
+ *  profiler.counter("edges", std::ssize(edges));
+ */
+template <bool Enabled>
+consteval auto makeProfiler()
+{
+    return Profiler<Enabled>{};
+}
+
 }  // namespace aoc2025::diagnostic
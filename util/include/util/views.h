@@ -1,8 +1,11 @@
 #pragma once
 
+#include <algorithm>
 #include <concepts>
+#include <cstddef>
 #include <ranges>
 #include <utility>
+#include <vector>
 
 namespace aoc2025::views
 {
@@ -22,6 +25,170 @@ constexpr auto upperTriangle(I n)
            | rv::join;
 }
 
+/**
+ * Tile of the upper triangle: pairs (i, j), i < j, with i in [rowBegin, rowEnd)
+ * and j in [columnBegin, columnEnd).
+ */
+template <std::integral I>
+struct PairBlock
+{
+    I rowBegin;
+    I rowEnd;
+    I columnBegin;
+    I columnEnd;
+};
+
+// Two blocks of a few hundred points stay in L1/L2 while all their pairs are visited
+constexpr inline int defaultPairBlockSize = 256;
+
+/**
+ * Number of pairs (i, j), i < j < n, with i < row.
+ */
+template <std::integral I>
+constexpr I pairsBefore(I n, I row)
+{
+    return row * n - row * (row + 1) / 2;
+}
+
+/**
+ * Position of the pair (i, j) in the row-major order of upperTriangle(n).
+ */
+template <std::integral I>
+constexpr I pairIndex(I n, I i, I j)
+{
+    return pairsBefore(n, i) + (j - i - 1);
+}
+static_assert(pairIndex(4, 0, 1) == 0);
+static_assert(pairIndex(4, 1, 2) == 3);
+static_assert(pairIndex(4, 2, 3) == pairsBefore(4, 4) - 1);
+
+/**
+ * Blocks covering all pairs (i, j), i < j < n, of the rows [rowBegin, rowEnd).
+ * Visit the pairs of a block with forEachPair, the inner loop is a plain counted
+ * loop the compiler can vectorize.
+ */
+template <std::integral I>
+constexpr auto upperTriangleBlocks(I rowBegin,
+                                   I rowEnd,
+                                   I n,
+                                   I blockSize = defaultPairBlockSize)
+{
+    namespace rv = std::views;
+    auto tiles = [blockSize](I length)
+    { return (std::max(length, I{}) + blockSize - 1) / blockSize; };
+    return rv::iota(I{}, tiles(rowEnd - rowBegin))
+           | rv::transform(
+               [=](I rowTile)
+               {
+                   auto top = rowBegin + rowTile * blockSize;
+                   auto bottom = std::min(top + blockSize, rowEnd);
+                   return rv::iota(I{}, tiles(n - top - 1))
+                          | rv::transform(
+                              [=](I columnTile)
+                              {
+                                  auto left = top + 1 + columnTile * blockSize;
+                                  return PairBlock<I>{
+                                      top, bottom, left, std::min(left + blockSize, n)};
+                              });
+               })
+           | rv::join;
+}
+
+template <std::integral I>
+constexpr auto upperTriangleBlocks(I n, I blockSize = defaultPairBlockSize)
+{
+    return upperTriangleBlocks(I{}, n, n, blockSize);
+}
+
+template <std::integral I, typename F>
+constexpr void forEachPair(const PairBlock<I>& block, F&& function)
+{
+    for (auto i = block.rowBegin; i < block.rowEnd; ++i)
+    {
+        for (auto j = std::max(i + 1, block.columnBegin); j < block.columnEnd; ++j)
+            function(i, j);
+    }
+}
+
+/**
+ * Calls function(i, jBegin, jEnd) for every non-empty row of a block, for batched
+ * kernels that handle one point against the columns [jBegin, jEnd) at once.
+ */
+template <std::integral I, typename F>
+constexpr void forEachRow(const PairBlock<I>& block, F&& function)
+{
+    for (auto i = block.rowBegin; i < block.rowEnd; ++i)
+    {
+        if (auto jBegin = std::max(i + 1, block.columnBegin); jBegin < block.columnEnd)
+            function(i, jBegin, block.columnEnd);
+    }
+}
+
+/**
+ * Splits the rows of upperTriangle(n) into `parts` contiguous ranges with
+ * (almost) the same number of pairs; rows get shorter, so ranges get longer.
+ */
+template <std::integral I>
+constexpr std::vector<std::pair<I, I>> partitionUpperTriangle(I n, std::size_t parts)
+{
+    auto total = pairsBefore(n, n);
+    std::vector<std::pair<I, I>> result;
+    I rowBegin = 0;
+    for (std::size_t part = 1; part <= parts; ++part)
+    {
+        auto target = static_cast<I>(total * static_cast<I>(part) / static_cast<I>(parts));
+        auto rowEnd = *std::ranges::partition_point(  //
+            std::views::iota(rowBegin, n),
+            [&](I row) { return pairsBefore(n, row) < target; });
+        if (part == parts)
+            rowEnd = n;
+        result.emplace_back(rowBegin, rowEnd);
+        rowBegin = rowEnd;
+    }
+    return result;
+}
+
+static_assert(
+    []
+    {
+        for (int n : {0, 1, 2, 7, 10})
+        {
+            for (auto [rowBegin, rowEnd] : partitionUpperTriangle(n, 3))
+            {
+                int visited = 0;
+                int batched = 0;
+                for (const auto& block : upperTriangleBlocks(rowBegin, rowEnd, n, 3))
+                {
+                    forEachPair(block,
+                                [&](int i, int j)
+                                {
+                                    visited += i >= rowBegin && i < rowEnd && i < j && j < n;
+                                });
+                    forEachRow(block,
+                               [&](int i, int jBegin, int jEnd)
+                               { batched += i < jBegin ? jEnd - jBegin : n; });
+                }
+                if (visited != pairsBefore(n, rowEnd) - pairsBefore(n, rowBegin)
+                    || batched != visited)
+                    return false;
+            }
+        }
+        return true;
+    }());
+static_assert(
+    []
+    {
+        auto parts = partitionUpperTriangle(100, 4);
+        return std::size(parts) == 4 && parts.front().first == 0 && parts.back().second == 100
+               && std::ranges::all_of(parts,
+                                      [](auto part)
+                                      {
+                                          auto pairs = pairsBefore(100, part.second)
+                                                       - pairsBefore(100, part.first);
+                                          return pairs > 1150 && pairs < 1325;
+                                      });
+    }());
+
 constexpr inline auto notEmpty = std::views::filter(
     [](const auto& container) noexcept { return not std::empty(container); });
 }  // namespace aoc2025::views
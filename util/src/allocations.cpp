@@ -0,0 +1,145 @@
+// Replaces the global operator new/delete to feed memory::AllocationScope, linked in
+// only with AOC_ALLOCATION_ACCOUNTING (see util/allocations.h).
+#include "util/allocations.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace
+{
+namespace detail = aoc2025::memory::detail;
+
+constexpr std::size_t defaultAlignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+// The size of a block is stored right before the pointer handed out; the block starts
+// `alignment` bytes earlier, so the pointer keeps the requested alignment.
+void* allocate(std::size_t size, std::size_t alignment) noexcept
+{
+    alignment = std::max(alignment, defaultAlignment);
+    auto total = (size + alignment + alignment - 1) / alignment * alignment;
+    auto* base = static_cast<char*>(std::aligned_alloc(alignment, total));
+    if (base == nullptr)
+        return nullptr;
+
+    auto* block = base + alignment;
+    std::memcpy(block - sizeof(size), &size, sizeof(size));
+    detail::recordAllocation(size);
+    return block;
+}
+
+void deallocate(void* pointer, std::size_t alignment) noexcept
+{
+    if (pointer == nullptr)
+        return;
+
+    auto* block = static_cast<char*>(pointer);
+    std::size_t size = 0;
+    std::memcpy(&size, block - sizeof(size), sizeof(size));
+    detail::recordDeallocation(size);
+    std::free(block - std::max(alignment, defaultAlignment));
+}
+
+void* allocateOrThrow(std::size_t size, std::size_t alignment)
+{
+    for (;;)
+    {
+        if (auto* block = allocate(size, alignment))
+            return block;
+        auto handler = std::get_new_handler();
+        if (handler == nullptr)
+            throw std::bad_alloc{};
+        handler();
+    }
+}
+
+const bool installed = (detail::installed = true);
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    return allocateOrThrow(size, defaultAlignment);
+}
+void* operator new[](std::size_t size)
+{
+    return allocateOrThrow(size, defaultAlignment);
+}
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size, defaultAlignment);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size, defaultAlignment);
+}
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size,
+                     std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept
+{
+    deallocate(pointer, defaultAlignment);
+}
+void operator delete[](void* pointer) noexcept
+{
+    deallocate(pointer, defaultAlignment);
+}
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer, defaultAlignment);
+}
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer, defaultAlignment);
+}
+void operator delete(void* pointer, std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+void operator delete(void* pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+void operator delete[](void* pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    deallocate(pointer, defaultAlignment);
+}
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    deallocate(pointer, defaultAlignment);
+}
+void operator delete(void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}
+void operator delete[](void* pointer,
+                       std::align_val_t alignment,
+                       const std::nothrow_t&) noexcept
+{
+    deallocate(pointer, static_cast<std::size_t>(alignment));
+}